@@ -0,0 +1,162 @@
+#include "adjacencyIndex.h"
+
+namespace {
+
+// Key of a free slot; real keys never have the sign bits of both halves set.
+const uint64_t EMPTY_KEY = ~0ULL;
+
+// Number of slots the table starts with once the first edge is indexed.
+const size_t INITIAL_SLOTS = 1024;
+
+} // namespace
+
+
+// Constructor for an empty AdjacencyIndex
+AdjacencyIndex::AdjacencyIndex() : count(0) {}
+
+/**
+ * Private function combining a vertex and one of its neighbors into a table key.
+ *
+ * @param u The vertex.
+ * @param v The neighbor.
+ * @return The key of the edge from u to v.
+ */
+uint64_t AdjacencyIndex::_key(int u, int v)
+{
+    return (static_cast<uint64_t>(static_cast<uint32_t>(u)) << 32) | static_cast<uint32_t>(v);
+}
+
+/**
+ * Private function hashing a key to its first slot. The key is scrambled with a multiplicative hash
+ * whose high bits pick the slot, so neighbors of one hub spread over the whole table.
+ *
+ * @param key The key to hash.
+ * @return The slot the key's probe sequence starts at.
+ */
+size_t AdjacencyIndex::_home_slot(uint64_t key) const
+{
+    return static_cast<size_t>((key * 0x9e3779b97f4a7c15ULL) >> 32) & (slots.size() - 1);
+}
+
+/**
+ * Private function probing for a key.
+ *
+ * @param key The key to look for.
+ * @return The slot holding the key, or the first free slot on its probe sequence.
+ */
+size_t AdjacencyIndex::_slot_of(uint64_t key) const
+{
+    size_t mask = slots.size() - 1;
+    size_t slot = _home_slot(key);
+    while (slots[slot].key != key && slots[slot].key != EMPTY_KEY)
+    {
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+/**
+ * Private function doubling the table, or allocating it on first use, and reinserting every edge.
+ */
+void AdjacencyIndex::_grow()
+{
+    std::vector<Slot> old(slots.empty() ? INITIAL_SLOTS : 2 * slots.size(), Slot{EMPTY_KEY, 0});
+    old.swap(slots);
+    for (const Slot &entry : old)
+    {
+        if (entry.key != EMPTY_KEY)
+        {
+            slots[_slot_of(entry.key)] = entry;
+        }
+    }
+}
+
+/**
+ * Indexes an edge. A parallel edge that is already indexed is kept, so lookups return the weight
+ * of the first edge between the two vertices, as a scan of the neighbor list would.
+ *
+ * @param u      The vertex the edge leaves.
+ * @param v      The neighbor it leads to.
+ * @param weight The weight of the edge.
+ */
+void AdjacencyIndex::insert(int u, int v, int weight)
+{
+    if (2 * (count + 1) > slots.size())
+    {
+        _grow();
+    }
+    uint64_t key = _key(u, v);
+    size_t slot = _slot_of(key);
+    if (slots[slot].key == EMPTY_KEY)
+    {
+        slots[slot] = Slot{key, weight};
+        count++;
+    }
+}
+
+/**
+ * Looks up an edge.
+ *
+ * @param u      The vertex the edge leaves.
+ * @param v      The neighbor it leads to.
+ * @param weight Receives the weight of the edge if it is indexed.
+ * @return True if an edge from u to v is indexed.
+ */
+bool AdjacencyIndex::find(int u, int v, int &weight) const
+{
+    if (count == 0)
+    {
+        return false;
+    }
+    const Slot &entry = slots[_slot_of(_key(u, v))];
+    if (entry.key == EMPTY_KEY)
+    {
+        return false;
+    }
+    weight = entry.weight;
+    return true;
+}
+
+/**
+ * Removes an edge from the index. Instead of leaving a tombstone in the slot, the entries after it on
+ * the same probe run are shifted back into the gap, so lookups never probe past removed edges.
+ *
+ * @param u The vertex the edge leaves.
+ * @param v The neighbor it leads to.
+ */
+void AdjacencyIndex::erase(int u, int v)
+{
+    if (count == 0)
+    {
+        return;
+    }
+    size_t hole = _slot_of(_key(u, v));
+    if (slots[hole].key == EMPTY_KEY)
+    {
+        return;
+    }
+    slots[hole].key = EMPTY_KEY;
+    count--;
+
+    size_t mask = slots.size() - 1;
+    for (size_t slot = (hole + 1) & mask; slots[slot].key != EMPTY_KEY; slot = (slot + 1) & mask)
+    {
+        // The entry may fill the hole unless its probe sequence starts after the hole.
+        size_t home = _home_slot(slots[slot].key);
+        if (((slot - home) & mask) >= ((slot - hole) & mask))
+        {
+            slots[hole] = slots[slot];
+            slots[slot].key = EMPTY_KEY;
+            hole = slot;
+        }
+    }
+}
+
+/**
+ * Removes every indexed edge and releases the table.
+ */
+void AdjacencyIndex::clear()
+{
+    slots.clear();
+    count = 0;
+}
@@ -0,0 +1,65 @@
+#include "astarHeuristics.h"
+#include <cmath>
+#include <cstdlib>
+
+/**
+ * Creates a straight-line distance heuristic.
+ *
+ * @param coordinates The (x, y) position of each vertex, indexed like the graph's vertices.
+ * @param scale       The smallest ratio between an edge weight and the distance between its endpoints.
+ */
+CoordinateHeuristic::CoordinateHeuristic(std::vector<std::pair<double, double> > coordinates, double scale)
+    : coordinates(std::move(coordinates)), scale(scale) {}
+
+/**
+ * Estimates the distance between two vertices from their coordinates.
+ *
+ * @param vertex The index of the vertex being expanded.
+ * @param target The index of the target vertex.
+ * @return The scaled straight-line distance, rounded down.
+ */
+int CoordinateHeuristic::operator()(int vertex, int target) const
+{
+    double dx = coordinates[vertex].first - coordinates[target].first;
+    double dy = coordinates[vertex].second - coordinates[target].second;
+    return static_cast<int>(std::floor(std::sqrt(dx * dx + dy * dy) * scale));
+}
+
+/**
+ * Returns the vertices chosen as landmarks, in the order they were picked.
+ *
+ * @return The vertex indices of the landmarks.
+ */
+const std::vector<int> &AltHeuristic::get_landmarks() const
+{
+    return landmarks;
+}
+
+/**
+ * Bounds the distance between two vertices with the triangle inequality over every landmark.
+ * Landmarks that cannot reach both vertices are skipped.
+ *
+ * @param vertex The index of the vertex being expanded.
+ * @param target The index of the target vertex.
+ * @return The largest lower bound any landmark provides, 0 if none applies.
+ */
+int AltHeuristic::operator()(int vertex, int target) const
+{
+    const int max = std::numeric_limits<int>::max();
+    const int *from_vertex = distances.data() + static_cast<size_t>(vertex) * number_of_landmarks;
+    const int *from_target = distances.data() + static_cast<size_t>(target) * number_of_landmarks;
+
+    int bound = 0;
+    for (int i = 0; i < number_of_landmarks; i++)
+    {
+        if (from_vertex[i] != max && from_target[i] != max)
+        {
+            int estimate = std::abs(from_target[i] - from_vertex[i]);
+            if (estimate > bound)
+            {
+                bound = estimate;
+            }
+        }
+    }
+    return bound;
+}
@@ -0,0 +1,113 @@
+#ifndef GRAPHLIB_ASTARHEURISTICS_H
+#define GRAPHLIB_ASTARHEURISTICS_H
+
+#include <limits>
+#include <vector>
+#include "graphAlgorithms.h"
+
+// Heuristics for shortest_path_astar. Each is a callable int(int vertex, int target) returning a
+// lower bound on the distance between the two vertices, indexed like the graph's vertices.
+
+// Straight-line distance between vertex coordinates, multiplied by scale and rounded down.
+// Admissible as long as every edge weight is at least scale times the distance between its endpoints.
+class CoordinateHeuristic {
+
+    std::vector<std::pair<double, double> > coordinates; // (x, y) of each vertex index.
+    double scale;                                        // Edge weight units per coordinate unit.
+
+public:
+
+    // Create a heuristic from the coordinates of every vertex.
+    explicit CoordinateHeuristic(std::vector<std::pair<double, double> > coordinates, double scale = 1.0);
+
+    // Get the lower bound on the distance between vertex and target.
+    int operator()(int vertex, int target) const;
+};
+
+// ALT heuristic: landmarks, A* and the triangle inequality. Shortest distances from a few landmark
+// vertices are precomputed, and |d(l, target) - d(l, vertex)| is a lower bound on d(vertex, target)
+// for every landmark l. The bound is tightest when landmarks sit on the periphery of the graph, so
+// landmarks are picked greedily, each one the vertex farthest from those already chosen.
+class AltHeuristic {
+
+    int number_of_landmarks;
+    std::vector<int> landmarks;  // Vertex indices of the landmarks.
+    std::vector<int> distances;  // Vertex-major: distances[v * number_of_landmarks + i] = d(landmarks[i], v).
+
+public:
+
+    // Precompute landmark distances over a Graph or CsrGraph with the existing Dijkstra.
+    template <typename G>
+    AltHeuristic(const G &graph, int num_landmarks);
+
+    // Get the vertex indices of the chosen landmarks.
+    const std::vector<int> &get_landmarks() const;
+
+    // Get the lower bound on the distance between vertex and target.
+    int operator()(int vertex, int target) const;
+};
+
+/**
+ * Picks landmarks by farthest-point selection and stores their shortest distances to every vertex.
+ * The first landmark is the vertex farthest from vertex 0; each further one maximises the distance
+ * to its closest landmark so far. Vertices no landmark reaches count as infinitely far, so every
+ * component gets a landmark before any component gets a second one.
+ *
+ * @param graph         The graph to precompute distances over.
+ * @param num_landmarks The number of landmarks; fewer are used if the graph is smaller.
+ */
+template <typename G>
+AltHeuristic::AltHeuristic(const G &graph, int num_landmarks) : number_of_landmarks(0)
+{
+    const int n = graph.num_verts();
+    if (n == 0 || num_landmarks <= 0)
+    {
+        return;
+    }
+
+    std::vector<std::vector<int> > landmark_distances;
+    std::vector<int> previous_nodes(n, -1);
+
+    // Distance of every vertex from vertex 0 at first, then from its closest landmark.
+    std::vector<int> spread = graph_algorithms::dijkstra(graph, 0, previous_nodes);
+
+    for (int i = 0; i < num_landmarks; i++)
+    {
+        int next = 0;
+        for (int v = 1; v < n; v++)
+        {
+            if (spread[v] > spread[next])
+            {
+                next = v;
+            }
+        }
+        if (i > 0 && spread[next] == 0)
+        {
+            break; // Every vertex already is a landmark.
+        }
+
+        landmark_distances.push_back(graph_algorithms::dijkstra(graph, next, previous_nodes));
+        landmarks.push_back(next);
+
+        const std::vector<int> &from_landmark = landmark_distances.back();
+        for (int v = 0; v < n; v++)
+        {
+            if (i == 0 || from_landmark[v] < spread[v])
+            {
+                spread[v] = from_landmark[v];
+            }
+        }
+    }
+
+    number_of_landmarks = static_cast<int>(landmarks.size());
+    distances.resize(static_cast<size_t>(n) * number_of_landmarks);
+    for (int v = 0; v < n; v++)
+    {
+        for (int i = 0; i < number_of_landmarks; i++)
+        {
+            distances[static_cast<size_t>(v) * number_of_landmarks + i] = landmark_distances[i][v];
+        }
+    }
+}
+
+#endif //GRAPHLIB_ASTARHEURISTICS_H
@@ -0,0 +1,245 @@
+#include "concurrentGraph.h"
+#include <algorithm>
+
+namespace {
+
+// Epoch of a reader slot that holds no snapshot. It is larger than any real epoch, so idle
+// slots never keep a retired version alive.
+const uint64_t IDLE_EPOCH = ~0ULL;
+
+} // namespace
+
+
+// Constructor for a snapshot pinned in slot
+ConcurrentGraph::Snapshot::Snapshot(ReaderSlot *slot, const Version *version) : slot(slot), version(version) {}
+
+// Move constructor handing the pin over to the new snapshot
+ConcurrentGraph::Snapshot::Snapshot(Snapshot &&other) noexcept : slot(other.slot), version(other.version)
+{
+    other.slot = nullptr;
+    other.version = nullptr;
+}
+
+// Destructor announcing that the reader no longer holds a version
+ConcurrentGraph::Snapshot::~Snapshot()
+{
+    if (slot != nullptr)
+    {
+        slot->epoch.store(IDLE_EPOCH);
+    }
+}
+
+/**
+ * Returns the pinned graph.
+ *
+ * @return The version of the graph that was current when the snapshot was pinned.
+ */
+const CsrGraph &ConcurrentGraph::Snapshot::operator*() const
+{
+    return version->graph;
+}
+
+/**
+ * Gives access to the queries of the pinned graph.
+ *
+ * @return The version of the graph that was current when the snapshot was pinned.
+ */
+const CsrGraph *ConcurrentGraph::Snapshot::operator->() const
+{
+    return &version->graph;
+}
+
+/**
+ * Returns the number of the pinned version.
+ *
+ * @return 0 for the empty graph before the first publish(), otherwise the value that publish() returned.
+ */
+uint64_t ConcurrentGraph::Snapshot::version_number() const
+{
+    return version->number;
+}
+
+/**
+ * Creates an empty graph. Readers pin an empty version until the first publish().
+ *
+ * @param num_readers The number of reader slots.
+ */
+ConcurrentGraph::ConcurrentGraph(int num_readers)
+    : current(new Version{CsrGraph(), 0}), epoch(0), num_readers(num_readers),
+      slots(new ReaderSlot[num_readers]), published(0)
+{
+    for (int reader = 0; reader < num_readers; reader++)
+    {
+        slots[reader].epoch.store(IDLE_EPOCH);
+    }
+}
+
+// Destructor freeing the current and every retired version
+ConcurrentGraph::~ConcurrentGraph()
+{
+    delete current.load();
+    for (const auto &entry : retired)
+    {
+        delete entry.first;
+    }
+}
+
+/**
+ * Returns the number of reader slots.
+ *
+ * @return The number of readers that can hold a snapshot at the same time.
+ */
+int ConcurrentGraph::reader_slots() const
+{
+    return num_readers;
+}
+
+/**
+ * Pins the current version for a reader. The reader announces the epoch before loading the version,
+ * so a writer that retires this version afterwards sees the announcement and keeps the version alive.
+ *
+ * @param reader The index of the reader, in [0, reader_slots()).
+ * @return The pinned version, released when the snapshot is destroyed.
+ */
+ConcurrentGraph::Snapshot ConcurrentGraph::pin(int reader) const
+{
+    ReaderSlot *slot = &slots[reader];
+    slot->epoch.store(epoch.load());
+    return Snapshot(slot, current.load());
+}
+
+/**
+ * Adds a vertex to the writers' graph.
+ *
+ * @param label The label of the vertex to be added.
+ * @return The index of the vertex with that label.
+ */
+int ConcurrentGraph::add_vertex(std::string_view label)
+{
+    std::lock_guard<std::mutex> lock(writer_mutex);
+    return working.add_vertex(label);
+}
+
+/**
+ * Adds an edge to the writers' graph.
+ *
+ * @param from   The label of the source vertex.
+ * @param to     The label of the destination vertex.
+ * @param weight The weight of the edge.
+ * @return True if the edge was added, false if either of the vertices doesn't exist.
+ */
+bool ConcurrentGraph::add_edge(std::string_view from, std::string_view to, int weight)
+{
+    std::lock_guard<std::mutex> lock(writer_mutex);
+    return working.add_edge(from, to, weight);
+}
+
+/**
+ * Adds an edge between two vertices given by index to the writers' graph.
+ *
+ * @param from   The index of the source vertex.
+ * @param to     The index of the destination vertex.
+ * @param weight The weight of the edge.
+ * @return True if the edge was added, false if either of the vertices doesn't exist.
+ */
+bool ConcurrentGraph::add_edge(int from, int to, int weight)
+{
+    std::lock_guard<std::mutex> lock(writer_mutex);
+    return working.add_edge(from, to, weight);
+}
+
+/**
+ * Removes an edge from the writers' graph.
+ *
+ * @param from The label of the source vertex.
+ * @param to   The label of the destination vertex.
+ * @return True if an edge was removed, false if either vertex or the edge doesn't exist.
+ */
+bool ConcurrentGraph::remove_edge(std::string_view from, std::string_view to)
+{
+    std::lock_guard<std::mutex> lock(writer_mutex);
+    return working.remove_edge(from, to);
+}
+
+/**
+ * Removes an edge between two vertices given by index from the writers' graph.
+ *
+ * @param from The index of the source vertex.
+ * @param to   The index of the destination vertex.
+ * @return True if an edge was removed, false if either vertex or the edge doesn't exist.
+ */
+bool ConcurrentGraph::remove_edge(int from, int to)
+{
+    std::lock_guard<std::mutex> lock(writer_mutex);
+    return working.remove_edge(from, to);
+}
+
+/**
+ * Removes a vertex and its edges from the writers' graph.
+ *
+ * @param label The label of the vertex to be removed.
+ * @return True if the vertex was removed, false if it doesn't exist.
+ */
+bool ConcurrentGraph::remove_vertex(std::string_view label)
+{
+    std::lock_guard<std::mutex> lock(writer_mutex);
+    return working.remove_vertex(label);
+}
+
+/**
+ * Removes a vertex given by index and its edges from the writers' graph.
+ *
+ * @param idx The index of the vertex to be removed.
+ * @return True if the vertex was removed, false if it doesn't exist.
+ */
+bool ConcurrentGraph::remove_vertex(int idx)
+{
+    std::lock_guard<std::mutex> lock(writer_mutex);
+    return working.remove_vertex(idx);
+}
+
+/**
+ * Publishes the writers' graph as a new version. The replaced version is tagged with the epoch read
+ * after the exchange, and the epoch is advanced in the same step: a reader that announced a later epoch
+ * loaded the version after the exchange, so it cannot be holding the replaced one.
+ *
+ * @return The number of the new version.
+ */
+uint64_t ConcurrentGraph::publish()
+{
+    std::lock_guard<std::mutex> lock(writer_mutex);
+    std::unique_ptr<Version> next(new Version{working.freeze(), published + 1});
+    retired.reserve(retired.size() + 1);
+    const Version *replaced = current.exchange(next.release());
+    retired.emplace_back(replaced, epoch.fetch_add(1));
+    published++;
+    _reclaim();
+    return published;
+}
+
+/**
+ * Private function freeing the retired versions that every reader has moved past. A version retired
+ * at epoch r may still be held by a reader whose slot announces an epoch of at most r.
+ */
+void ConcurrentGraph::_reclaim()
+{
+    uint64_t oldest = IDLE_EPOCH;
+    for (int reader = 0; reader < num_readers; reader++)
+    {
+        oldest = std::min(oldest, slots[reader].epoch.load());
+    }
+
+    size_t kept = 0;
+    for (const auto &entry : retired)
+    {
+        if (entry.second < oldest)
+        {
+            delete entry.first;
+        }
+        else
+        {
+            retired[kept++] = entry;
+        }
+    }
+    retired.resize(kept);
+}
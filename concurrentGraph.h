@@ -0,0 +1,123 @@
+#ifndef GRAPHLIB_CONCURRENTGRAPH_H
+#define GRAPHLIB_CONCURRENTGRAPH_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "csrGraph.h"
+#include "graph.h"
+
+// Graph that writer threads update while reader threads keep running queries, with no lock on the read side.
+//
+// Writers edit a private Graph under a mutex. publish() freezes it into a new immutable CsrGraph version
+// and installs that with one atomic exchange, so a reader sees either the old version or the new one, never
+// a half-applied update. A reader pins the current version with pin(reader), runs any CsrGraph query on
+// it for as long as it needs, and unpins it when the Snapshot is destroyed. Pinning is wait-free: it reads
+// the global epoch, announces it in the reader's slot and loads the current version.
+// Vertices removed by the writers keep their indices in later versions, but their labels no longer resolve.
+//
+// Replaced versions are reclaimed by epoch. publish() tags the version it replaces with the epoch at the
+// time of the exchange and then advances the epoch. Only a reader that announced that epoch or an earlier
+// one can still hold the old version, so it is freed as soon as every reader slot is idle or newer.
+class ConcurrentGraph {
+
+    // Epoch announced by one reader while it holds a snapshot. Each slot has a cache line of its
+    // own, so readers on different cores never write to the same line.
+    struct alignas(64) ReaderSlot {
+        std::atomic<uint64_t> epoch;
+    };
+
+    // A published snapshot and its version number.
+    struct Version {
+        CsrGraph graph;
+        uint64_t number;
+    };
+
+    std::mutex writer_mutex;                                    // Serializes writers; readers never take it.
+    Graph working;                                              // The graph writers edit.
+    std::atomic<const Version *> current;                       // The version new snapshots pin.
+    std::atomic<uint64_t> epoch;                                // Global epoch, advanced by every publish().
+    int num_readers;                                            // Number of reader slots.
+    std::unique_ptr<ReaderSlot[]> slots;                        // Announced epoch of each reader.
+    uint64_t published;                                         // Number of the newest version.
+    std::vector<std::pair<const Version *, uint64_t> > retired; // Replaced versions with their retire epochs.
+
+    // Free every retired version no reader can still hold. Called with writer_mutex held.
+    void _reclaim();
+
+public:
+
+    // A pinned version of the graph. The version stays alive, unchanged, until the Snapshot is destroyed.
+    class Snapshot {
+
+        ReaderSlot *slot;
+        const Version *version;
+
+        friend class ConcurrentGraph;
+
+        Snapshot(ReaderSlot *slot, const Version *version);
+
+    public:
+
+        Snapshot(Snapshot &&other) noexcept;
+        Snapshot(const Snapshot &) = delete;
+        Snapshot &operator=(const Snapshot &) = delete;
+        Snapshot &operator=(Snapshot &&) = delete;
+
+        // Unpin the version, letting the writers reclaim it once it is no longer current.
+        ~Snapshot();
+
+        // Get the pinned graph.
+        const CsrGraph &operator*() const;
+        const CsrGraph *operator->() const;
+
+        // Get the number of the pinned version: 0 before the first publish(), then 1, 2, ...
+        uint64_t version_number() const;
+    };
+
+    // Create an empty graph that num_readers reader threads, numbered [0, num_readers), can pin.
+    explicit ConcurrentGraph(int num_readers);
+
+    ConcurrentGraph(const ConcurrentGraph &) = delete;
+    ConcurrentGraph &operator=(const ConcurrentGraph &) = delete;
+
+    // Free every version. No snapshot may outlive the graph.
+    ~ConcurrentGraph();
+
+    // Get the number of reader slots.
+    int reader_slots() const;
+
+    // Pin the current version for a reader. Never blocks. A reader index holds one snapshot at a time,
+    // so use one index per thread, e.g. the thread index a ThreadPool passes to its tasks.
+    Snapshot pin(int reader) const;
+
+    // Same as Graph::add_vertex, Graph::add_edge, Graph::remove_edge and Graph::remove_vertex on the
+    // writers' graph. Changes become visible to readers at the next publish().
+    int add_vertex(std::string_view label);
+    bool add_edge(std::string_view from, std::string_view to, int weight = 1);
+    bool add_edge(int from, int to, int weight = 1);
+    bool remove_edge(std::string_view from, std::string_view to);
+    bool remove_edge(int from, int to);
+    bool remove_vertex(std::string_view label);
+    bool remove_vertex(int idx);
+
+    // Run f(Graph &) on the writers' graph under the writer lock, for a batch of changes or any other
+    // Graph operation, and return its result. Changes become visible to readers at the next publish().
+    template <typename F>
+    auto update(F f)
+    {
+        std::lock_guard<std::mutex> lock(writer_mutex);
+        return f(working);
+    }
+
+    // Freeze the writers' graph into a new version for readers, reclaim versions no reader holds any more,
+    // and return the new version number. Every publish copies the whole graph, so batch changes between calls.
+    uint64_t publish();
+
+};
+
+#endif //GRAPHLIB_CONCURRENTGRAPH_H
@@ -0,0 +1,234 @@
+#include "concurrentIngestor.h"
+#include "labelShards.h"
+#include <limits>
+#include <stdexcept>
+
+namespace {
+
+// Minimum number of label shards per producer. More shards make it less likely that two producers
+// intern labels of the same shard at the same time.
+const size_t SHARDS_PER_PRODUCER = 8;
+
+} // namespace
+
+
+/**
+ * Creates an empty ingestor. The label table gets a power-of-two number of shards, at least
+ * SHARDS_PER_PRODUCER per producer.
+ *
+ * @param num_producers The number of producer slots.
+ */
+ConcurrentIngestor::ConcurrentIngestor(int num_producers)
+    : num_producers(num_producers), num_shards(1), producers(new Producer[num_producers])
+{
+    while (num_shards < SHARDS_PER_PRODUCER * static_cast<size_t>(num_producers))
+    {
+        num_shards *= 2;
+    }
+    shards.reset(new Shard[num_shards]);
+}
+
+/**
+ * Returns the number of producer slots.
+ *
+ * @return The number of producers that can add edges at the same time.
+ */
+int ConcurrentIngestor::producer_slots() const
+{
+    return num_producers;
+}
+
+/**
+ * Reserves room for edges a producer will add, so its buffers grow only once.
+ *
+ * @param producer The index of the producer.
+ * @param count    The total number of edges expected from it.
+ */
+void ConcurrentIngestor::reserve_edges(int producer, size_t count)
+{
+    Producer &buffer = producers[producer];
+    buffer.sources.reserve(count);
+    buffer.targets.reserve(count);
+    buffer.weights.reserve(count);
+}
+
+/**
+ * Private function interning a label. The label is hashed before its shard is locked, so the lock is
+ * held only for the table lookup.
+ *
+ * @param label The label to intern.
+ * @return The shard of the label in the high 32 bits and its id within the shard in the low 32 bits.
+ */
+uint64_t ConcurrentIngestor::_intern(std::string_view label)
+{
+    size_t hash = LabelTable::hash(label);
+    size_t shard = label_shards::shard_of(hash, num_shards);
+    int local;
+    {
+        std::lock_guard<std::mutex> lock(shards[shard].mutex);
+        local = shards[shard].labels.intern(label, hash);
+    }
+    return (static_cast<uint64_t>(shard) << 32) | static_cast<uint32_t>(local);
+}
+
+/**
+ * Adds a vertex without edges.
+ *
+ * @param label The label of the vertex to be added.
+ */
+void ConcurrentIngestor::add_vertex(std::string_view label)
+{
+    _intern(label);
+}
+
+/**
+ * Adds one edge to a producer's buffers.
+ *
+ * @param producer The index of the calling producer.
+ * @param from     The label of the source vertex.
+ * @param to       The label of the destination vertex.
+ * @param weight   The weight of the edge.
+ */
+void ConcurrentIngestor::add_edge(int producer, std::string_view from, std::string_view to, int weight)
+{
+    Producer &buffer = producers[producer];
+    buffer.sources.push_back(_intern(from));
+    buffer.targets.push_back(_intern(to));
+    buffer.weights.push_back(weight);
+}
+
+/**
+ * Adds a batch of edges to a producer's buffers.
+ *
+ * @param producer The index of the calling producer.
+ * @param edges    The edges as (from label, to label, weight).
+ */
+void ConcurrentIngestor::add_edges(int producer, const std::vector<std::tuple<std::string_view, std::string_view, int>> &edges)
+{
+    Producer &buffer = producers[producer];
+    reserve_edges(producer, buffer.sources.size() + edges.size());
+    for (const auto &edge : edges)
+    {
+        buffer.sources.push_back(_intern(std::get<0>(edge)));
+        buffer.targets.push_back(_intern(std::get<1>(edge)));
+        buffer.weights.push_back(std::get<2>(edge));
+    }
+}
+
+/**
+ * Counts the vertices added so far.
+ *
+ * @return The number of distinct labels over all shards.
+ */
+int ConcurrentIngestor::num_verts() const
+{
+    int count = 0;
+    for (size_t shard = 0; shard < num_shards; shard++)
+    {
+        count += shards[shard].labels.size();
+    }
+    return count;
+}
+
+/**
+ * Counts the edges added so far.
+ *
+ * @return The number of edges over all producers.
+ */
+size_t ConcurrentIngestor::num_edges() const
+{
+    size_t count = 0;
+    for (int producer = 0; producer < num_producers; producer++)
+    {
+        count += producers[producer].sources.size();
+    }
+    return count;
+}
+
+/**
+ * Private function turning the shards and producer buffers into the vertices and edges of a builder.
+ * Vertices are numbered shard by shard, in the order their labels reached the shard, so the index of a
+ * shard key is the number of labels in earlier shards plus its id within the shard. The shards hold
+ * disjoint label sets, so each is appended to the builder's table in one block with its stored hashes,
+ * without hashing or looking up any label again. Edges are copied producer by producer, with every
+ * thread rewriting a contiguous range of each producer's edges.
+ *
+ * @param builder An empty builder that receives the vertices and edges.
+ * @param pool    The threads to rewrite the edges on.
+ * @throws std::overflow_error if there are more vertices than int indices.
+ */
+void ConcurrentIngestor::_merge(GraphBuilder &builder, ThreadPool &pool) const
+{
+    std::vector<int> shard_first(num_shards);
+    size_t total = 0;
+    for (size_t shard = 0; shard < num_shards; shard++)
+    {
+        shard_first[shard] = static_cast<int>(total);
+        total += shards[shard].labels.size();
+        if (total > static_cast<size_t>(std::numeric_limits<int>::max()))
+        {
+            throw std::overflow_error("Too many vertices for int indices");
+        }
+    }
+    for (size_t shard = 0; shard < num_shards; shard++)
+    {
+        builder.vertex_labels.append(shards[shard].labels);
+    }
+    builder.number_of_verts = static_cast<int>(total);
+
+    size_t edge_count = num_edges();
+    builder.edge_sources.resize(edge_count);
+    builder.edge_targets.resize(edge_count);
+    builder.edge_weights.resize(edge_count);
+
+    auto vertex_of = [&](uint64_t key)
+    {
+        return shard_first[key >> 32] + static_cast<int>(key & 0xffffffffULL);
+    };
+
+    size_t first = 0;
+    const size_t num_threads = pool.num_threads();
+    for (int producer = 0; producer < num_producers; producer++)
+    {
+        const Producer &buffer = producers[producer];
+        const size_t count = buffer.sources.size();
+        pool.run_on_all([&](int thread_index)
+        {
+            size_t begin = count * thread_index / num_threads;
+            size_t end = count * (thread_index + 1) / num_threads;
+            for (size_t e = begin; e < end; e++)
+            {
+                builder.edge_sources[first + e] = vertex_of(buffer.sources[e]);
+                builder.edge_targets[first + e] = vertex_of(buffer.targets[e]);
+                builder.edge_weights[first + e] = buffer.weights[e];
+            }
+        });
+        first += count;
+    }
+}
+
+/**
+ * Merges the ingested vertices and edges into an immutable CSR snapshot.
+ *
+ * @param pool The threads to merge and sort the edges on.
+ * @return The snapshot, with every producer's edges in the order they were added.
+ */
+CsrGraph ConcurrentIngestor::build_csr(ThreadPool &pool) const
+{
+    GraphBuilder builder;
+    _merge(builder, pool);
+    return builder.build_csr(pool);
+}
+
+/**
+ * Merges the ingested vertices and edges into a Graph.
+ *
+ * @param pool The threads to merge and sort the edges on.
+ * @return The graph, with every producer's edges in the order they were added.
+ */
+Graph ConcurrentIngestor::build(ThreadPool &pool) const
+{
+    GraphBuilder builder;
+    _merge(builder, pool);
+    return builder.build(pool);
+}
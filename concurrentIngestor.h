@@ -0,0 +1,89 @@
+#ifndef GRAPHLIB_CONCURRENTINGESTOR_H
+#define GRAPHLIB_CONCURRENTINGESTOR_H
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <tuple>
+#include <vector>
+#include "csrGraph.h"
+#include "graph.h"
+#include "graphBuilder.h"
+#include "labelTable.h"
+#include "threadPool.h"
+
+// Edge collector that many producer threads feed at the same time, merged into a CSR snapshot or Graph
+// once ingestion is done.
+//
+// Every producer appends its edges to buffers of its own, so adding an edge never waits for another
+// producer's edges. Endpoint labels are interned in a table split into shards by label hash, each behind
+// its own mutex; with several shards per producer, two producers rarely want the same shard at once. An
+// edge records each endpoint as (shard, id within the shard). The merge numbers the vertices shard by shard,
+// rewrites the endpoints in parallel and hands the edges to GraphBuilder's counting sort.
+//
+// Vertex indices depend on the order in which labels reach their shards, and the edges of different
+// producers are laid out producer by producer, so the result matches a sequential load up to renumbering
+// of vertices and reordering of neighbors. Each producer's own edges keep their order.
+class ConcurrentIngestor {
+
+    // One shard of the label table. Aligned so that the mutexes of neighbouring shards do not share a cache line.
+    struct alignas(64) Shard {
+        std::mutex mutex;
+        LabelTable labels;
+    };
+
+    // The edges one producer has added, with each endpoint as (shard << 32) | id within the shard.
+    struct alignas(64) Producer {
+        std::vector<uint64_t> sources;
+        std::vector<uint64_t> targets;
+        std::vector<int> weights;
+    };
+
+    int num_producers;                       // Number of producer slots.
+    size_t num_shards;                       // Number of label shards, a power of two.
+    std::unique_ptr<Shard[]> shards;         // Label shards, selected by label hash.
+    std::unique_ptr<Producer[]> producers;   // Edge buffers of each producer.
+
+    // Intern a label in its shard and return its shard key.
+    uint64_t _intern(std::string_view label);
+
+    // Number the vertices and rewrite every edge into a GraphBuilder.
+    void _merge(GraphBuilder &builder, ThreadPool &pool) const;
+
+public:
+
+    // Create an empty ingestor for num_producers producer threads, numbered [0, num_producers).
+    explicit ConcurrentIngestor(int num_producers);
+
+    ConcurrentIngestor(const ConcurrentIngestor &) = delete;
+    ConcurrentIngestor &operator=(const ConcurrentIngestor &) = delete;
+
+    // Get the number of producer slots.
+    int producer_slots() const;
+
+    // Reserve room for a number of edges from one producer.
+    void reserve_edges(int producer, size_t count);
+
+    // Add a vertex with the specified label, if no vertex has it yet. Safe to call from any thread.
+    void add_vertex(std::string_view label);
+
+    // Add an edge from a producer, adding both labels as vertices if they are new. Producers may call this
+    // at the same time as long as each uses its own index, e.g. the thread index a ThreadPool passes.
+    void add_edge(int producer, std::string_view from, std::string_view to, int weight = 1);
+
+    // Add a batch of (from label, to label, weight) edges from a producer, as add_edge does one by one.
+    void add_edges(int producer, const std::vector<std::tuple<std::string_view, std::string_view, int> > &edges);
+
+    // Get the number of vertices and edges added so far. Call once the producers are done.
+    int num_verts() const;
+    size_t num_edges() const;
+
+    // Merge everything added so far into an immutable CSR snapshot, or a Graph that can still be modified.
+    // Call once the producers are done; ingestion can then continue and be merged again.
+    CsrGraph build_csr(ThreadPool &pool) const;
+    Graph build(ThreadPool &pool) const;
+
+};
+
+#endif //GRAPHLIB_CONCURRENTINGESTOR_H
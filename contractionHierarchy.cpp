@@ -0,0 +1,810 @@
+#include "contractionHierarchy.h"
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+// Edge of the remaining graph during contraction.
+struct ContractionEdge {
+    int target;
+    int weight;
+    int middle; // Contracted vertex the edge bypasses, -1 for an original edge.
+};
+
+// Witness searches stop after settling this many vertices. Missing a witness only adds a
+// redundant shortcut, so the limit trades preprocessing time against hierarchy size.
+const int WITNESS_SETTLE_LIMIT = 500;
+
+typedef std::priority_queue<std::pair<int, int>, std::vector<std::pair<int, int>>, std::greater<std::pair<int, int>>> MinQueue;
+
+// Dijkstra over the remaining graph that resets only the entries it touched, so each of the many
+// short witness searches costs time proportional to the part of the graph it explores.
+class WitnessSearch {
+
+    std::vector<int> distances;
+    std::vector<int> touched;
+    MinQueue queue;
+
+public:
+
+    explicit WitnessSearch(int n) : distances(n, std::numeric_limits<int>::max()) {}
+
+    // Search from source without passing through skip, up to max_distance.
+    void run(const std::vector<std::vector<ContractionEdge>> &adj, int source, int skip, int max_distance)
+    {
+        distances[source] = 0;
+        touched.push_back(source);
+        queue.push({0, source});
+
+        int settled = 0;
+        while (!queue.empty() && settled < WITNESS_SETTLE_LIMIT)
+        {
+            auto [d, u] = queue.top();
+            queue.pop();
+            if (d > distances[u])
+            {
+                continue;
+            }
+            if (d > max_distance)
+            {
+                break;
+            }
+            settled++;
+
+            for (const auto &edge : adj[u])
+            {
+                if (edge.target == skip)
+                {
+                    continue;
+                }
+                int candidate = d + edge.weight;
+                if (candidate < distances[edge.target])
+                {
+                    if (distances[edge.target] == std::numeric_limits<int>::max())
+                    {
+                        touched.push_back(edge.target);
+                    }
+                    distances[edge.target] = candidate;
+                    queue.push({candidate, edge.target});
+                }
+            }
+        }
+        queue = MinQueue();
+    }
+
+    // Get the distance found by the last run, max if the vertex was not reached.
+    int distance(int v) const
+    {
+        return distances[v];
+    }
+
+    // Forget the last run.
+    void reset()
+    {
+        for (int v : touched)
+        {
+            distances[v] = std::numeric_limits<int>::max();
+        }
+        touched.clear();
+    }
+};
+
+// Contraction state: the remaining graph plus the edges of every contracted vertex.
+class Contractor {
+
+    std::vector<std::vector<ContractionEdge>> adj;  // Remaining graph, one edge per neighbor pair.
+    WitnessSearch witness;
+
+    // Add or shorten the edge u - w in the remaining graph.
+    void _add_shortcut(int u, int w, int weight, int middle)
+    {
+        for (int end = 0; end < 2; end++)
+        {
+            int from = end == 0 ? u : w;
+            int to = end == 0 ? w : u;
+            bool found = false;
+            for (auto &edge : adj[from])
+            {
+                if (edge.target == to)
+                {
+                    if (weight < edge.weight)
+                    {
+                        edge.weight = weight;
+                        edge.middle = middle;
+                    }
+                    found = true;
+                    break;
+                }
+            }
+            if (!found)
+            {
+                adj[from].push_back({to, weight, middle});
+            }
+        }
+    }
+
+public:
+
+    std::vector<std::vector<ContractionEdge>> upward; // Edges each vertex had when it was contracted.
+
+    explicit Contractor(const CsrGraph &graph) : adj(graph.num_verts()), witness(graph.num_verts()), upward(graph.num_verts())
+    {
+        // Copy the graph without self loops, keeping the lightest of parallel edges.
+        for (int u = 0; u < graph.num_verts(); u++)
+        {
+            graph.for_each_neighbor(u, [&](int v, int weight)
+            {
+                if (u != v)
+                {
+                    _add_shortcut(u, v, weight, -1);
+                }
+            });
+        }
+    }
+
+    // Get the neighbors of v in the remaining graph.
+    const std::vector<ContractionEdge> &neighbors(int v) const
+    {
+        return adj[v];
+    }
+
+    // Count (simulate) or add the shortcuts needed to remove v from the remaining graph.
+    int process(int v, bool simulate)
+    {
+        // Shortcuts join two neighbors of v and never touch adj[v] itself, so it is read in place.
+        const std::vector<ContractionEdge> &edges = adj[v];
+        int shortcuts = 0;
+
+        for (size_t i = 0; i + 1 < edges.size(); i++)
+        {
+            int max_second = 0;
+            for (size_t j = i + 1; j < edges.size(); j++)
+            {
+                max_second = std::max(max_second, edges[j].weight);
+            }
+
+            witness.run(adj, edges[i].target, v, edges[i].weight + max_second);
+            for (size_t j = i + 1; j < edges.size(); j++)
+            {
+                int via = edges[i].weight + edges[j].weight;
+                if (witness.distance(edges[j].target) > via)
+                {
+                    shortcuts++;
+                    if (!simulate)
+                    {
+                        _add_shortcut(edges[i].target, edges[j].target, via, v);
+                    }
+                }
+            }
+            witness.reset();
+        }
+        return shortcuts;
+    }
+
+    // Remove v from the remaining graph, keeping its edges as upward edges.
+    void contract(int v)
+    {
+        process(v, false);
+        upward[v] = adj[v];
+        for (const auto &edge : adj[v])
+        {
+            auto &back = adj[edge.target];
+            back.erase(std::remove_if(back.begin(), back.end(),
+                                      [v](const ContractionEdge &e) { return e.target == v; }), back.end());
+        }
+        adj[v].clear();
+        adj[v].shrink_to_fit();
+    }
+};
+
+/**
+ * Checks that every vertex index is in range before a search is started from it.
+ *
+ * @param indices   The vertex indices to check.
+ * @param num_verts The number of vertices.
+ * @throws std::out_of_range If an index is negative or not below num_verts.
+ */
+void check_indices(const std::vector<int> &indices, int num_verts)
+{
+    for (int index : indices)
+    {
+        if (index < 0 || index >= num_verts)
+        {
+            throw std::out_of_range("Vertex index out of range: " + std::to_string(index));
+        }
+    }
+}
+
+} // namespace
+
+// Distances and parents of the forward (0) and backward (1) query searches.
+struct ContractionHierarchy::SearchSpace {
+    std::vector<int> distances[2];
+    std::vector<int> parents[2];
+    std::vector<int> parent_middles[2];
+    std::vector<int> touched[2];
+    std::vector<std::pair<int, int>> queues[2]; // Binary heaps ordered by std::greater, kept allocated between queries.
+
+    // Make room for n vertices; entries are kept at max between queries.
+    void prepare(int n)
+    {
+        for (int side = 0; side < 2; side++)
+        {
+            if (static_cast<int>(distances[side].size()) < n)
+            {
+                distances[side].resize(n, std::numeric_limits<int>::max());
+                parents[side].resize(n, -1);
+                parent_middles[side].resize(n, -1);
+            }
+        }
+    }
+
+    // Restore every touched entry to its initial value.
+    void reset()
+    {
+        for (int side = 0; side < 2; side++)
+        {
+            for (int v : touched[side])
+            {
+                distances[side][v] = std::numeric_limits<int>::max();
+                parents[side][v] = -1;
+                parent_middles[side][v] = -1;
+            }
+            touched[side].clear();
+            queues[side].clear();
+        }
+    }
+};
+
+/**
+ * Preprocesses a frozen graph into a contraction hierarchy.
+ *
+ * @param graph The graph to preprocess.
+ */
+ContractionHierarchy::ContractionHierarchy(const CsrGraph &graph)
+    : number_of_verts(graph.num_verts()), number_of_shortcuts(0),
+      vertex_labels(graph.vertex_labels)
+{
+    _build(graph);
+}
+
+/**
+ * Contracts every vertex in order of importance and packs the upward edges into CSR arrays.
+ * A vertex's importance is twice its edge difference (shortcuts its contraction would add minus
+ * its degree), plus the number of its neighbors already contracted and its depth in the hierarchy
+ * so far; the last two spread contraction evenly across the graph and keep searches shallow.
+ * Priorities are updated lazily: a popped vertex is re-evaluated and put back if it is no longer the
+ * least important one.
+ *
+ * @param graph The graph to preprocess.
+ */
+void ContractionHierarchy::_build(const CsrGraph &graph)
+{
+    Contractor contractor(graph);
+    std::vector<int> contracted_neighbors(number_of_verts, 0);
+    std::vector<int> priorities(number_of_verts, 0);
+    std::vector<int> levels(number_of_verts, 0);
+    std::vector<bool> contracted(number_of_verts, false);
+
+    auto priority = [&](int v)
+    {
+        int degree = contractor.neighbors(v).size();
+        return 2 * (contractor.process(v, true) - degree) + contracted_neighbors[v] + levels[v];
+    };
+
+    MinQueue order;
+    for (int v = 0; v < number_of_verts; v++)
+    {
+        priorities[v] = priority(v);
+        order.push({priorities[v], v});
+    }
+
+    ranks.assign(number_of_verts, 0);
+    int next_rank = 0;
+    while (!order.empty())
+    {
+        auto [p, v] = order.top();
+        order.pop();
+        if (contracted[v] || p != priorities[v])
+        {
+            continue;
+        }
+
+        int updated = priority(v);
+        if (updated > p && !order.empty() && updated > order.top().first)
+        {
+            priorities[v] = updated;
+            order.push({updated, v});
+            continue;
+        }
+
+        std::vector<int> neighbors;
+        for (const auto &edge : contractor.neighbors(v))
+        {
+            neighbors.push_back(edge.target);
+        }
+
+        contractor.contract(v);
+        contracted[v] = true;
+        ranks[v] = next_rank++;
+
+        for (int u : neighbors)
+        {
+            contracted_neighbors[u]++;
+            levels[u] = std::max(levels[u], levels[v] + 1);
+            priorities[u] = priority(u);
+            order.push({priorities[u], u});
+        }
+    }
+
+    up_offsets.assign(number_of_verts + 1, 0);
+    for (int v = 0; v < number_of_verts; v++)
+    {
+        up_offsets[v + 1] = up_offsets[v] + static_cast<int>(contractor.upward[v].size());
+    }
+    for (int v = 0; v < number_of_verts; v++)
+    {
+        for (const auto &edge : contractor.upward[v])
+        {
+            up_targets.push_back(edge.target);
+            up_weights.push_back(edge.weight);
+            up_middles.push_back(edge.middle);
+            if (edge.middle != -1)
+            {
+                number_of_shortcuts++;
+            }
+        }
+    }
+}
+
+/**
+ * Runs Dijkstra upwards from both endpoints. A direction stops once its smallest key reaches the
+ * best meeting distance, since everything it could still settle is at least that far away.
+ *
+ * @param source  The index of the source vertex.
+ * @param target  The index of the target vertex.
+ * @param space   The search space to fill; the caller resets it.
+ * @param meeting Receives the highest vertex of the shortest path, or -1 if target is unreachable.
+ * @return The shortest distance, or std::numeric_limits<int>::max() if target is unreachable.
+ */
+int ContractionHierarchy::_search(int source, int target, SearchSpace &space, int &meeting) const
+{
+    const int max = std::numeric_limits<int>::max();
+    space.prepare(number_of_verts);
+
+    int endpoints[2] = {source, target};
+    for (int side = 0; side < 2; side++)
+    {
+        space.distances[side][endpoints[side]] = 0;
+        space.touched[side].push_back(endpoints[side]);
+        space.queues[side].push_back({0, endpoints[side]});
+    }
+
+    int best = max;
+    meeting = -1;
+    while (!space.queues[0].empty() || !space.queues[1].empty())
+    {
+        for (int side = 0; side < 2; side++)
+        {
+            std::vector<std::pair<int, int>> &queue = space.queues[side];
+            if (queue.empty())
+            {
+                continue;
+            }
+
+            std::pop_heap(queue.begin(), queue.end(), std::greater<std::pair<int, int>>());
+            auto [d, u] = queue.back();
+            queue.pop_back();
+            if (d >= best)
+            {
+                queue.clear();
+                continue;
+            }
+            std::vector<int> &dist = space.distances[side];
+            if (d > dist[u])
+            {
+                continue;
+            }
+
+            int other = space.distances[1 - side][u];
+            if (other != max && d + other < best)
+            {
+                best = d + other;
+                meeting = u;
+            }
+
+            // Stall-on-demand: a higher neighbor that already offers a shorter route to u proves u's
+            // distance is not final, so nothing reached through u can be on a shortest path.
+            bool stalled = false;
+            for (int e = up_offsets[u]; e < up_offsets[u + 1] && !stalled; e++)
+            {
+                int v = up_targets[e];
+                stalled = dist[v] != max && dist[v] + up_weights[e] < d;
+            }
+            if (stalled)
+            {
+                continue;
+            }
+
+            for (int e = up_offsets[u]; e < up_offsets[u + 1]; e++)
+            {
+                int v = up_targets[e];
+                int candidate = d + up_weights[e];
+                if (candidate < dist[v])
+                {
+                    if (dist[v] == max)
+                    {
+                        space.touched[side].push_back(v);
+                    }
+                    dist[v] = candidate;
+                    space.parents[side][v] = u;
+                    space.parent_middles[side][v] = up_middles[e];
+                    queue.push_back({candidate, v});
+                    std::push_heap(queue.begin(), queue.end(), std::greater<std::pair<int, int>>());
+                }
+            }
+        }
+    }
+    return best;
+}
+
+/**
+ * Runs Dijkstra upwards from one vertex without a distance bound, using the forward half of the
+ * search space, and lists the vertices it settles. Stalled vertices are left out, since no shortest
+ * path can run through them.
+ *
+ * @param source  The index of the start vertex.
+ * @param space   The search space to use; the caller resets it.
+ * @param settled Receives (vertex, distance) for every settled vertex.
+ */
+void ContractionHierarchy::_upward_search(int source, SearchSpace &space, std::vector<std::pair<int, int>> &settled) const
+{
+    const int max = std::numeric_limits<int>::max();
+    space.prepare(number_of_verts);
+
+    std::vector<int> &dist = space.distances[0];
+    std::vector<std::pair<int, int>> &queue = space.queues[0];
+    dist[source] = 0;
+    space.touched[0].push_back(source);
+    queue.push_back({0, source});
+
+    settled.clear();
+    while (!queue.empty())
+    {
+        std::pop_heap(queue.begin(), queue.end(), std::greater<std::pair<int, int>>());
+        auto [d, u] = queue.back();
+        queue.pop_back();
+        if (d > dist[u])
+        {
+            continue;
+        }
+
+        bool stalled = false;
+        for (int e = up_offsets[u]; e < up_offsets[u + 1] && !stalled; e++)
+        {
+            int v = up_targets[e];
+            stalled = dist[v] != max && dist[v] + up_weights[e] < d;
+        }
+        if (stalled)
+        {
+            continue;
+        }
+        settled.emplace_back(u, d);
+
+        for (int e = up_offsets[u]; e < up_offsets[u + 1]; e++)
+        {
+            int v = up_targets[e];
+            int candidate = d + up_weights[e];
+            if (candidate < dist[v])
+            {
+                if (dist[v] == max)
+                {
+                    space.touched[0].push_back(v);
+                }
+                dist[v] = candidate;
+                queue.push_back({candidate, v});
+                std::push_heap(queue.begin(), queue.end(), std::greater<std::pair<int, int>>());
+            }
+        }
+    }
+}
+
+/**
+ * Finds the upward edge between two vertices.
+ *
+ * @param lower  The lower-ranked endpoint.
+ * @param higher The higher-ranked endpoint.
+ * @return The index of the edge in the upward arrays, or -1 if there is none.
+ */
+int ContractionHierarchy::_find_up_edge(int lower, int higher) const
+{
+    for (int e = up_offsets[lower]; e < up_offsets[lower + 1]; e++)
+    {
+        if (up_targets[e] == higher)
+        {
+            return e;
+        }
+    }
+    return -1;
+}
+
+/**
+ * Expands an edge into the original vertices it stands for. A shortcut from - to via middle is
+ * replaced by its two halves, which are upward edges of middle, until only original edges remain.
+ *
+ * @param from   The first endpoint of the edge.
+ * @param to     The second endpoint of the edge.
+ * @param middle The vertex the edge bypasses, -1 for an original edge.
+ * @param path   Receives every vertex after from, up to and including to.
+ */
+void ContractionHierarchy::_unpack_edge(int from, int to, int middle, std::vector<int> &path) const
+{
+    std::vector<std::tuple<int, int, int>> pending = {{from, to, middle}};
+    while (!pending.empty())
+    {
+        auto [a, b, m] = pending.back();
+        pending.pop_back();
+        if (m == -1)
+        {
+            path.push_back(b);
+            continue;
+        }
+        // Push the second half first so the first half is expanded first.
+        pending.emplace_back(m, b, up_middles[_find_up_edge(m, b)]);
+        pending.emplace_back(a, m, up_middles[_find_up_edge(m, a)]);
+    }
+}
+
+/**
+ * Returns the total number of vertices in the graph.
+ *
+ * @return The number of vertices in the graph.
+ */
+int ContractionHierarchy::num_verts() const
+{
+    return number_of_verts;
+}
+
+/**
+ * Returns the number of shortcut edges added during preprocessing.
+ *
+ * @return The number of shortcuts.
+ */
+int ContractionHierarchy::num_shortcuts() const
+{
+    return number_of_shortcuts;
+}
+
+/**
+ * Returns the position of a vertex in the contraction order.
+ *
+ * @param vertex The index of the vertex.
+ * @return The rank of the vertex; the first contracted vertex has rank 0.
+ */
+int ContractionHierarchy::rank(int vertex) const
+{
+    return ranks[vertex];
+}
+
+/**
+ * Computes the shortest distance between two vertex indices.
+ *
+ * @param source The index of the source vertex.
+ * @param target The index of the target vertex.
+ * @return The shortest distance, std::numeric_limits<int>::max() if target is unreachable, or -1 if
+ *         either index is out of range.
+ */
+int ContractionHierarchy::distance(int source, int target) const
+{
+    if (source < 0 || source >= number_of_verts || target < 0 || target >= number_of_verts)
+    {
+        return -1;
+    }
+
+    thread_local SearchSpace space;
+    int meeting;
+    int result = _search(source, target, space, meeting);
+    space.reset();
+    return result;
+}
+
+/**
+ * Computes the shortest path between two vertex indices, with every shortcut unpacked.
+ *
+ * @param source The index of the source vertex.
+ * @param target The index of the target vertex.
+ * @return The vertex indices of the path from source to target, empty if target is unreachable or
+ *         either index is out of range.
+ */
+std::vector<int> ContractionHierarchy::path(int source, int target) const
+{
+    if (source < 0 || source >= number_of_verts || target < 0 || target >= number_of_verts)
+    {
+        return {};
+    }
+
+    thread_local SearchSpace space;
+    int meeting;
+    _search(source, target, space, meeting);
+
+    std::vector<int> result;
+    if (meeting != -1)
+    {
+        // Upward half: walk from the meeting vertex down to the source, then expand in source order.
+        std::vector<int> chain;
+        for (int v = meeting; v != -1; v = space.parents[0][v])
+        {
+            chain.push_back(v);
+        }
+        result.push_back(source);
+        for (size_t i = chain.size() - 1; i > 0; i--)
+        {
+            _unpack_edge(chain[i], chain[i - 1], space.parent_middles[0][chain[i - 1]], result);
+        }
+
+        // Downward half: follow the backward search from the meeting vertex to the target.
+        for (int v = meeting; space.parents[1][v] != -1; v = space.parents[1][v])
+        {
+            _unpack_edge(v, space.parents[1][v], space.parent_middles[1][v], result);
+        }
+    }
+    space.reset();
+    return result;
+}
+
+/**
+ * Computes a distance matrix with the bucket-based many-to-many algorithm. An upward search from
+ * every target leaves a (column, distance) entry in a bucket at each vertex it settles. An upward
+ * search from every source then scans the buckets of the vertices it settles: a source and a target
+ * meet at the highest vertex of their shortest path, so the smallest sum found is their distance.
+ * Both phases run their searches in parallel, and each thread reuses its own search space.
+ *
+ * @param sources The indices of the source vertices (matrix rows).
+ * @param targets The indices of the target vertices (matrix columns).
+ * @param pool    The threads to run on.
+ * @return The row-major distance matrix.
+ * @throws std::out_of_range If a source or target index is out of range.
+ */
+DistanceMatrix ContractionHierarchy::distance_matrix(const std::vector<int> &sources, const std::vector<int> &targets, ThreadPool &pool) const
+{
+    check_indices(sources, number_of_verts);
+    check_indices(targets, number_of_verts);
+    const int max = std::numeric_limits<int>::max();
+
+    DistanceMatrix matrix;
+    matrix.rows = static_cast<int>(sources.size());
+    matrix.cols = static_cast<int>(targets.size());
+    matrix.values.assign(static_cast<size_t>(matrix.rows) * matrix.cols, max);
+
+    // Backward phase: every thread collects (vertex, column, distance) entries for its targets.
+    std::vector<std::vector<std::tuple<int, int, int>>> entries(pool.num_threads());
+    pool.parallel_for(0, matrix.cols, [&](int thread_index, int col)
+    {
+        thread_local SearchSpace space;
+        thread_local std::vector<std::pair<int, int>> settled;
+        _upward_search(targets[col], space, settled);
+        for (const auto &entry : settled)
+        {
+            entries[thread_index].emplace_back(entry.first, col, entry.second);
+        }
+        space.reset();
+    }, 1);
+
+    // Counting sort the entries into one bucket per vertex.
+    std::vector<int> bucket_offsets(number_of_verts + 1, 0);
+    for (const auto &list : entries)
+    {
+        for (const auto &entry : list)
+        {
+            bucket_offsets[std::get<0>(entry) + 1]++;
+        }
+    }
+    for (int v = 0; v < number_of_verts; v++)
+    {
+        bucket_offsets[v + 1] += bucket_offsets[v];
+    }
+    std::vector<int> bucket_cols(bucket_offsets[number_of_verts]);
+    std::vector<int> bucket_distances(bucket_offsets[number_of_verts]);
+    std::vector<int> fill(bucket_offsets.begin(), bucket_offsets.end() - 1);
+    for (auto &list : entries)
+    {
+        for (const auto &entry : list)
+        {
+            int slot = fill[std::get<0>(entry)]++;
+            bucket_cols[slot] = std::get<1>(entry);
+            bucket_distances[slot] = std::get<2>(entry);
+        }
+        std::vector<std::tuple<int, int, int>>().swap(list);
+    }
+
+    // Forward phase: every source scans the buckets along its upward search space.
+    pool.parallel_for(0, matrix.rows, [&](int, int row)
+    {
+        thread_local SearchSpace space;
+        thread_local std::vector<std::pair<int, int>> settled;
+        _upward_search(sources[row], space, settled);
+
+        int *out = matrix.values.data() + static_cast<size_t>(row) * matrix.cols;
+        for (const auto &entry : settled)
+        {
+            for (int b = bucket_offsets[entry.first]; b < bucket_offsets[entry.first + 1]; b++)
+            {
+                int d = entry.second + bucket_distances[b];
+                if (d < out[bucket_cols[b]])
+                {
+                    out[bucket_cols[b]] = d;
+                }
+            }
+        }
+        space.reset();
+    }, 1);
+
+    return matrix;
+}
+
+/**
+ * Computes a distance matrix between vertices given by label.
+ *
+ * @param sources The labels of the source vertices (matrix rows).
+ * @param targets The labels of the target vertices (matrix columns).
+ * @param pool    The threads to run on.
+ * @return The row-major distance matrix.
+ */
+DistanceMatrix ContractionHierarchy::distance_matrix(const std::vector<std::string> &sources, const std::vector<std::string> &targets, ThreadPool &pool) const
+{
+    std::vector<int> source_indices;
+    std::vector<int> target_indices;
+    for (const auto &label : sources)
+    {
+        source_indices.push_back(vertex_labels.at(label));
+    }
+    for (const auto &label : targets)
+    {
+        target_indices.push_back(vertex_labels.at(label));
+    }
+    return distance_matrix(source_indices, target_indices, pool);
+}
+
+/**
+ * Computes the shortest distance between two vertices.
+ *
+ * @param source The label of the source vertex.
+ * @param target The label of the target vertex.
+ * @return The shortest distance, or std::numeric_limits<int>::max() if target is unreachable.
+ */
+int ContractionHierarchy::shortest_distance(const std::string &source, const std::string &target) const
+{
+    return distance(vertex_labels.at(source), vertex_labels.at(target));
+}
+
+/**
+ * Computes and returns the shortest path from a source vertex to a target vertex as a string representation.
+ *
+ * @param source The label of the source vertex.
+ * @param target The label of the target vertex.
+ * @return A string representation of the shortest path, or just the target label if it is unreachable.
+ */
+std::string ContractionHierarchy::shortest_path(const std::string &source, const std::string &target) const
+{
+    int target_idx = vertex_labels.at(target);
+    std::vector<int> vertices = path(vertex_labels.at(source), target_idx);
+    if (vertices.empty())
+    {
+        vertices.push_back(target_idx);
+    }
+
+    std::string path_string;
+    for (size_t i = 0; i < vertices.size(); i++)
+    {
+        path_string += vertex_labels.label_of(vertices[i]);
+        if (i < vertices.size() - 1)
+        {
+            path_string += " - ";
+        }
+    }
+    return path_string;
+}
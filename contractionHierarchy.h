@@ -0,0 +1,93 @@
+#ifndef GRAPHLIB_CONTRACTIONHIERARCHY_H
+#define GRAPHLIB_CONTRACTIONHIERARCHY_H
+
+#include <string>
+#include <vector>
+#include "csrGraph.h"
+#include "labelTable.h"
+
+// Contraction hierarchy over a frozen graph, for fast repeated point-to-point queries.
+//
+// Preprocessing contracts vertices one at a time, least important first. Contracting v removes it
+// from the remaining graph and adds a shortcut u - w (weight w(u, v) + w(v, w)) for every pair of
+// remaining neighbors whose shortest connection runs through v. Each vertex keeps the edges it had
+// when it was contracted, which all lead to higher-ranked vertices; together they form the upward
+// search graph. Because edges are symmetric, one upward graph serves both query directions: a query
+// runs Dijkstra upwards from the source and from the target and meets at the highest vertex of the
+// shortest path, settling only a tiny part of the graph.
+class ContractionHierarchy {
+
+    int number_of_verts;                        // Total number of vertices in the graph.
+    std::vector<int> ranks;                     // Contraction order of each vertex, higher is more important.
+    std::vector<int> up_offsets;                // Start of each vertex's upward edges, number_of_verts + 1 entries.
+    std::vector<int> up_targets;                // Higher-ranked endpoint of each upward edge.
+    std::vector<int> up_weights;                // Weight of each upward edge.
+    std::vector<int> up_middles;                // Contracted vertex a shortcut bypasses, -1 for an original edge.
+    int number_of_shortcuts;                    // Number of shortcut edges added during preprocessing.
+    LabelTable vertex_labels;                   // Mapping between vertex labels and their indices.
+
+    // Per-thread distances and parents of the two query searches.
+    struct SearchSpace;
+
+    // Contract every vertex and build the upward search graph.
+    void _build(const CsrGraph &graph);
+
+    // Run the bidirectional upward search, returning the distance and the meeting vertex (or -1).
+    int _search(int source, int target, SearchSpace &space, int &meeting) const;
+
+    // Run a full upward search from source, listing every vertex it settles with its distance.
+    void _upward_search(int source, SearchSpace &space, std::vector<std::pair<int, int> > &settled) const;
+
+    // Find the index of the upward edge from lower to higher.
+    int _find_up_edge(int lower, int higher) const;
+
+    // Append the original vertices an edge stands for, excluding its first endpoint.
+    void _unpack_edge(int from, int to, int middle, std::vector<int> &path) const;
+
+public:
+
+    // Preprocess a frozen graph into a contraction hierarchy.
+    explicit ContractionHierarchy(const CsrGraph &graph);
+
+    // Get the total number of vertices in the graph.
+    int num_verts() const;
+
+    // Get the number of shortcut edges added during preprocessing.
+    int num_shortcuts() const;
+
+    // Get the rank (contraction order) of a vertex index.
+    int rank(int vertex) const;
+
+    // Call f(neighbor_index, weight) for every upward edge leaving vertex u.
+    template <typename F>
+    void for_each_up_edge(int u, F f) const
+    {
+        for (int e = up_offsets[u]; e < up_offsets[u + 1]; e++)
+        {
+            f(up_targets[e], up_weights[e]);
+        }
+    }
+
+    // Compute the shortest distance between two vertex indices. Returns -1 if either is out of range.
+    int distance(int source, int target) const;
+
+    // Compute the shortest path between two vertex indices, unpacked to original vertices. Empty if the
+    // target is unreachable or either index is out of range.
+    std::vector<int> path(int source, int target) const;
+
+    // Compute the distance from every source index to every target index with bucket-based many-to-many search.
+    // Throws std::out_of_range, before any search starts, if an index is out of range.
+    DistanceMatrix distance_matrix(const std::vector<int> &sources, const std::vector<int> &targets, ThreadPool &pool) const;
+
+    // Compute the distance from every source to every target vertex with bucket-based many-to-many search.
+    DistanceMatrix distance_matrix(const std::vector<std::string> &sources, const std::vector<std::string> &targets, ThreadPool &pool) const;
+
+    // Compute the shortest distance between two vertices.
+    int shortest_distance(const std::string &source, const std::string &target) const;
+
+    // Find the shortest path between a source and target vertex, in the same format as Graph::shortest_path.
+    std::string shortest_path(const std::string &source, const std::string &target) const;
+
+};
+
+#endif //GRAPHLIB_CONTRACTIONHIERARCHY_H
@@ -0,0 +1,428 @@
+#include "csrGraph.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+namespace {
+
+const char SNAPSHOT_MAGIC[8] = {'G', 'L', 'C', 'S', 'R', 'S', 'N', 'P'};
+const uint32_t SNAPSHOT_VERSION = 1;
+
+// Written in the writer's byte order; a reader with the other byte order sees a different value.
+const uint32_t SNAPSHOT_BYTE_ORDER = 0x01020304;
+
+// Every section starts at a multiple of this many bytes, so mapped arrays are aligned for their element type.
+const uint64_t SNAPSHOT_ALIGNMENT = 64;
+
+// The arrays stored in a snapshot, in file order.
+enum SnapshotSection {
+    SECTION_OFFSETS,
+    SECTION_TARGETS,
+    SECTION_WEIGHTS,
+    SECTION_LABEL_ARENA,
+    SECTION_LABEL_OFFSETS,
+    SECTION_LABEL_HASHES,
+    SECTION_LABEL_SLOTS,
+    SECTION_LABEL_SEEDS,
+    NUM_SNAPSHOT_SECTIONS
+};
+
+// Location of one array in the file.
+struct SnapshotSectionEntry {
+    uint64_t offset;    // Byte position of the first element.
+    uint64_t bytes;     // Length of the array in bytes.
+    uint64_t checksum;  // snapshot_checksum of the array.
+};
+
+// Fixed-size block at the start of every snapshot file.
+struct SnapshotHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t byte_order;
+    uint32_t word_bytes;        // sizeof(size_t) of the writer, the element size of the label offsets and hashes.
+    int32_t num_verts;
+    uint64_t file_bytes;        // Length of the whole file.
+    SnapshotSectionEntry sections[NUM_SNAPSHOT_SECTIONS];
+    uint64_t header_checksum;   // snapshot_checksum of every field above.
+};
+
+// Checksum a block of bytes with four independent multiply-xorshift lanes, so long sections run at memory speed.
+uint64_t snapshot_checksum(const char *data, size_t bytes)
+{
+    const uint64_t prime = 0x9e3779b97f4a7c15ULL;
+    uint64_t lanes[4] = {1, 2, 3, 4};
+    size_t i = 0;
+    for (; i + sizeof(lanes) <= bytes; i += sizeof(lanes))
+    {
+        for (int k = 0; k < 4; k++)
+        {
+            uint64_t word;
+            std::memcpy(&word, data + i + k * sizeof(word), sizeof(word));
+            lanes[k] = (lanes[k] ^ word) * prime;
+            lanes[k] ^= lanes[k] >> 29;
+        }
+    }
+    for (int k = 0; i < bytes; k++)
+    {
+        uint64_t word = 0;
+        size_t n = std::min(bytes - i, sizeof(word));
+        std::memcpy(&word, data + i, n);
+        lanes[k] = (lanes[k] ^ word) * prime;
+        lanes[k] ^= lanes[k] >> 29;
+        i += n;
+    }
+
+    uint64_t h = bytes;
+    for (uint64_t lane : lanes)
+    {
+        h = (h ^ lane) * prime;
+        h ^= h >> 32;
+    }
+    return h;
+}
+
+// Round a file position up to the next section boundary.
+uint64_t align_section(uint64_t position)
+{
+    return (position + SNAPSHOT_ALIGNMENT - 1) / SNAPSHOT_ALIGNMENT * SNAPSHOT_ALIGNMENT;
+}
+
+// Point a MappedArray at a section of a mapped snapshot.
+template <typename T>
+MappedArray<T> map_section(const std::shared_ptr<const MappedFile> &file, const SnapshotSectionEntry &section)
+{
+    return MappedArray<T>(file, reinterpret_cast<const T *>(file->data() + section.offset), section.bytes / sizeof(T));
+}
+
+/**
+ * Checks that the arrays of a mapped snapshot only hold indices that queries can follow: neighbor and
+ * label offsets never decrease or run past their arrays, targets name vertices, and every hash table
+ * slot is empty or names a vertex. Reads every element once.
+ *
+ * @param offsets       The CSR offsets, num_verts + 1 entries starting at 0.
+ * @param targets       The CSR targets.
+ * @param label_offsets The label offsets, num_verts + 1 entries starting at 0.
+ * @param arena_bytes   The length of the label arena.
+ * @param slots         The label hash table.
+ * @param num_verts     The number of vertices.
+ * @return True if every index is in range.
+ */
+bool snapshot_arrays_are_valid(const MappedArray<int> &offsets, const MappedArray<int> &targets, const MappedArray<size_t> &label_offsets,
+                               size_t arena_bytes, const MappedArray<int> &slots, int num_verts)
+{
+    for (int v = 0; v < num_verts; v++)
+    {
+        if (offsets[v + 1] < offsets[v] || label_offsets[v + 1] < label_offsets[v] || label_offsets[v + 1] > arena_bytes)
+        {
+            return false;
+        }
+    }
+    for (size_t e = 0; e < targets.size(); e++)
+    {
+        if (targets[e] < 0 || targets[e] >= num_verts)
+        {
+            return false;
+        }
+    }
+    for (size_t slot = 0; slot < slots.size(); slot++)
+    {
+        if (slots[slot] < -1 || slots[slot] >= num_verts)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+
+// Constructor for the CsrGraph class
+CsrGraph::CsrGraph() : number_of_verts(0), offsets(std::vector<int>(1, 0)), sorted_adjacency(false) {}
+
+/**
+ * Counts the total number of edges in the graph.
+ *
+ * @return The number of edges in the graph.
+ */
+int CsrGraph::num_edges() const
+{
+    return static_cast<int>(targets.size());
+}
+
+/**
+ * Returns the total number of vertices in the graph.
+ *
+ * @return The number of vertices in the graph.
+ */
+int CsrGraph::num_verts() const
+{
+    return number_of_verts;
+}
+
+/**
+ * Checks whether an index names a vertex of the graph.
+ *
+ * @param idx The index to check.
+ * @return True if idx is in [0, num_verts()).
+ */
+bool CsrGraph::_is_vertex(int idx) const
+{
+    return idx >= 0 && idx < number_of_verts;
+}
+
+/**
+ * Private function looking up the weight of an edge, for GraphQueries::edge_weight.
+ *
+ * @param from The index of the source vertex, which must be a vertex.
+ * @param to   The index of the destination vertex, which must be a vertex.
+ * @return The weight of the edge between the specified vertices, or -1 if no such edge exists.
+ */
+int CsrGraph::_edge_weight(int from, int to) const
+{
+    int first = offsets[from];
+    int degree = offsets[from + 1] - first;
+    if (sorted_adjacency)
+    {
+        int weight;
+        if (static_cast<size_t>(degree) >= AdjacencyIndex::MIN_DEGREE)
+        {
+            return hub_index.find(from, to, weight) ? weight : -1;
+        }
+        const int *neighbors = targets.data() + first;
+        int position = lower_bound_neighbor(degree, to, [&](int i) { return neighbors[i]; });
+        return position < degree && neighbors[position] == to ? weights[first + position] : -1;
+    }
+
+    for (int e = first; e < first + degree; e++)
+    {
+        if (targets[e] == to)
+        {
+            return weights[e];
+        }
+    }
+    return -1;
+}
+
+/**
+ * Private function viewing the edges leaving a vertex, for GraphQueries::neighbors. The ids and weights
+ * are slices of the targets and weights arrays, so the view is contiguous; for a mapped snapshot it
+ * points into the mapped file.
+ *
+ * @param u The index of the vertex, which must be a vertex.
+ * @return A view of the vertex's (neighbor, weight) edges.
+ */
+NeighborView CsrGraph::_neighbor_view(int u) const
+{
+    int first = offsets[u];
+    return NeighborView(targets.data() + first, weights.data() + first, static_cast<size_t>(offsets[u + 1] - first));
+}
+
+/**
+ * Sorts every vertex's neighbors by index, keeping parallel edges in their original order, and indexes
+ * the edges of every vertex with at least AdjacencyIndex::MIN_DEGREE neighbors. Neighbor lists that are
+ * already sorted are left alone, so a snapshot mapped from a sorted file stays mapped.
+ */
+void CsrGraph::sort_adjacency()
+{
+    if (sorted_adjacency)
+    {
+        return;
+    }
+
+    bool sorted = true;
+    for (int u = 0; u < number_of_verts && sorted; u++)
+    {
+        sorted = std::is_sorted(targets.data() + offsets[u], targets.data() + offsets[u + 1]);
+    }
+    if (!sorted)
+    {
+        std::vector<int> &neighbors = targets.vector();
+        std::vector<int> &edge_weights = weights.vector();
+        std::vector<std::pair<int, int>> edges;
+        for (int u = 0; u < number_of_verts; u++)
+        {
+            edges.clear();
+            for (int e = offsets[u]; e < offsets[u + 1]; e++)
+            {
+                edges.emplace_back(neighbors[e], edge_weights[e]);
+            }
+            std::stable_sort(edges.begin(), edges.end(), [](const std::pair<int, int> &a, const std::pair<int, int> &b)
+            {
+                return a.first < b.first;
+            });
+            for (size_t i = 0; i < edges.size(); i++)
+            {
+                neighbors[offsets[u] + i] = edges[i].first;
+                edge_weights[offsets[u] + i] = edges[i].second;
+            }
+        }
+    }
+
+    for (int u = 0; u < number_of_verts; u++)
+    {
+        if (static_cast<size_t>(offsets[u + 1] - offsets[u]) >= AdjacencyIndex::MIN_DEGREE)
+        {
+            for (int e = offsets[u]; e < offsets[u + 1]; e++)
+            {
+                hub_index.insert(u, targets[e], weights[e]);
+            }
+        }
+    }
+    sorted_adjacency = true;
+}
+
+/**
+ * Checks whether neighbor lists are sorted and indexed.
+ *
+ * @return True after sort_adjacency(), or for a snapshot frozen from a graph in sorted adjacency mode.
+ */
+bool CsrGraph::has_sorted_adjacency() const
+{
+    return sorted_adjacency;
+}
+
+/**
+ * Writes the snapshot to a binary file: a fixed header followed by the CSR arrays and the label
+ * table arrays, each starting on a 64-byte boundary and each with its own checksum. The label table
+ * is written as it is, so a snapshot from freeze() keeps its perfect hash on disk.
+ *
+ * @param path The file to write.
+ * @return True if the file was written, false if it could not be created or a write failed.
+ */
+bool CsrGraph::save(const std::string &path) const
+{
+    const std::pair<const char *, uint64_t> arrays[NUM_SNAPSHOT_SECTIONS] = {
+        {reinterpret_cast<const char *>(offsets.data()), offsets.size() * sizeof(int)},
+        {reinterpret_cast<const char *>(targets.data()), targets.size() * sizeof(int)},
+        {reinterpret_cast<const char *>(weights.data()), weights.size() * sizeof(int)},
+        {vertex_labels.arena.data(), vertex_labels.arena.size()},
+        {reinterpret_cast<const char *>(vertex_labels.label_offsets.data()), vertex_labels.label_offsets.size() * sizeof(size_t)},
+        {reinterpret_cast<const char *>(vertex_labels.label_hashes.data()), vertex_labels.label_hashes.size() * sizeof(size_t)},
+        {reinterpret_cast<const char *>(vertex_labels.slots.data()), vertex_labels.slots.size() * sizeof(int)},
+        {reinterpret_cast<const char *>(vertex_labels.seeds.data()), vertex_labels.seeds.size() * sizeof(uint32_t)},
+    };
+
+    SnapshotHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+    header.version = SNAPSHOT_VERSION;
+    header.byte_order = SNAPSHOT_BYTE_ORDER;
+    header.word_bytes = sizeof(size_t);
+    header.num_verts = number_of_verts;
+
+    uint64_t position = align_section(sizeof(header));
+    for (int i = 0; i < NUM_SNAPSHOT_SECTIONS; i++)
+    {
+        header.sections[i].offset = position;
+        header.sections[i].bytes = arrays[i].second;
+        header.sections[i].checksum = snapshot_checksum(arrays[i].first, arrays[i].second);
+        position = align_section(position + arrays[i].second);
+    }
+    header.file_bytes = position;
+    header.header_checksum = snapshot_checksum(reinterpret_cast<const char *>(&header), offsetof(SnapshotHeader, header_checksum));
+
+    std::ofstream out(path, std::ios::binary);
+    if (!out)
+    {
+        return false;
+    }
+
+    const char padding[SNAPSHOT_ALIGNMENT] = {};
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    uint64_t written = sizeof(header);
+    for (int i = 0; i < NUM_SNAPSHOT_SECTIONS; i++)
+    {
+        out.write(padding, static_cast<std::streamsize>(header.sections[i].offset - written));
+        out.write(arrays[i].first, static_cast<std::streamsize>(arrays[i].second));
+        written = header.sections[i].offset + arrays[i].second;
+    }
+    out.write(padding, static_cast<std::streamsize>(header.file_bytes - written));
+    return static_cast<bool>(out);
+}
+
+/**
+ * Maps a file written by save() and points the CSR arrays and the label table at the mapped pages.
+ * Nothing is copied or parsed: the header is checked, a few boundary entries are compared, and
+ * pages are read from disk as queries touch them. The mapping stays open until this snapshot and
+ * every copy of it are gone. Verifying also checks every offset, target and hash table slot, so a
+ * file that is well-formed but was not written by save() cannot make queries read out of bounds.
+ *
+ * @param path             The file to map.
+ * @param verify_checksums Whether to read every section, compare it against its checksum and check
+ *                         that every index it holds is in range.
+ * @return True if the snapshot was opened, false if the file is missing, truncated, corrupt or was
+ *         written with a different byte order or word size. On failure the snapshot is unchanged.
+ */
+bool CsrGraph::open(const std::string &path, bool verify_checksums)
+{
+    auto file = std::make_shared<MappedFile>();
+    if (!file->open(path) || file->size() < sizeof(SnapshotHeader))
+    {
+        return false;
+    }
+
+    SnapshotHeader header;
+    std::memcpy(&header, file->data(), sizeof(header));
+    if (!std::equal(header.magic, header.magic + sizeof(SNAPSHOT_MAGIC), SNAPSHOT_MAGIC)
+        || header.version != SNAPSHOT_VERSION || header.byte_order != SNAPSHOT_BYTE_ORDER
+        || header.word_bytes != sizeof(size_t) || header.num_verts < 0 || header.file_bytes != file->size()
+        || header.header_checksum != snapshot_checksum(file->data(), offsetof(SnapshotHeader, header_checksum)))
+    {
+        return false;
+    }
+
+    const size_t element_bytes[NUM_SNAPSHOT_SECTIONS] = {
+        sizeof(int), sizeof(int), sizeof(int), sizeof(char), sizeof(size_t), sizeof(size_t), sizeof(int), sizeof(uint32_t)
+    };
+    for (int i = 0; i < NUM_SNAPSHOT_SECTIONS; i++)
+    {
+        const SnapshotSectionEntry &section = header.sections[i];
+        if (section.offset % SNAPSHOT_ALIGNMENT != 0 || section.offset > file->size()
+            || section.bytes > file->size() - section.offset || section.bytes % element_bytes[i] != 0)
+        {
+            return false;
+        }
+        if (verify_checksums && section.checksum != snapshot_checksum(file->data() + section.offset, section.bytes))
+        {
+            return false;
+        }
+    }
+
+    CsrGraph mapped;
+    mapped.number_of_verts = header.num_verts;
+    mapped.offsets = map_section<int>(file, header.sections[SECTION_OFFSETS]);
+    mapped.targets = map_section<int>(file, header.sections[SECTION_TARGETS]);
+    mapped.weights = map_section<int>(file, header.sections[SECTION_WEIGHTS]);
+
+    LabelTable &labels = mapped.vertex_labels;
+    labels.arena = map_section<char>(file, header.sections[SECTION_LABEL_ARENA]);
+    labels.label_offsets = map_section<size_t>(file, header.sections[SECTION_LABEL_OFFSETS]);
+    labels.label_hashes = map_section<size_t>(file, header.sections[SECTION_LABEL_HASHES]);
+    labels.slots = map_section<int>(file, header.sections[SECTION_LABEL_SLOTS]);
+    labels.seeds = map_section<uint32_t>(file, header.sections[SECTION_LABEL_SEEDS]);
+
+    // The array lengths must agree with each other, and a probing table needs a power-of-two size with room to spare.
+    size_t n = static_cast<size_t>(header.num_verts);
+    size_t num_slots = labels.slots.size();
+    bool probing_ok = num_slots > n && (num_slots & (num_slots - 1)) == 0;
+    if (mapped.offsets.size() != n + 1 || mapped.offsets[0] != 0
+        || static_cast<size_t>(mapped.offsets[n]) != mapped.targets.size() || mapped.weights.size() != mapped.targets.size()
+        || labels.label_offsets.size() != n + 1 || labels.label_hashes.size() != n
+        || labels.label_offsets[0] != 0 || labels.label_offsets[n] != labels.arena.size()
+        || (labels.seeds.empty() ? !probing_ok : num_slots < n || num_slots == 0))
+    {
+        return false;
+    }
+    if (verify_checksums && !snapshot_arrays_are_valid(mapped.offsets, mapped.targets, labels.label_offsets, labels.arena.size(),
+                                                       labels.slots, header.num_verts))
+    {
+        return false;
+    }
+
+    *this = std::move(mapped);
+    return true;
+}
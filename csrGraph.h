@@ -0,0 +1,89 @@
+#ifndef GRAPHLIB_CSRGRAPH_H
+#define GRAPHLIB_CSRGRAPH_H
+
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+#include "adjacencyIndex.h"
+#include "graphQueries.h"
+#include "labelTable.h"
+#include "mappedFile.h"
+#include "neighborView.h"
+
+// Immutable compressed sparse row snapshot of a Graph, produced by Graph::freeze().
+// The neighbors of vertex u are targets[offsets[u] .. offsets[u + 1]) with the matching
+// entries of weights, so a traversal walks two contiguous arrays instead of one heap
+// allocation per vertex.
+//
+// save() writes the arrays and the frozen label table to a binary file section by section, and
+// open() maps such a file and points the arrays straight at its pages, so loading does no parsing.
+// The queries are the same as Graph's, from GraphQueries.
+class CsrGraph : public GraphQueries<CsrGraph> {
+
+    int number_of_verts;                        // Total number of vertices in the graph.
+    MappedArray<int> offsets;                   // Start of each vertex's neighbors, number_of_verts + 1 entries.
+    MappedArray<int> targets;                   // Neighbor indices of every vertex, packed back to back.
+    MappedArray<int> weights;                   // Edge weights, parallel to targets.
+    LabelTable vertex_labels;                   // Mapping between vertex labels and their indices.
+    bool sorted_adjacency;                      // Whether every vertex's neighbors are sorted by index.
+    AdjacencyIndex hub_index;                   // Edges of high-degree vertices, in sorted adjacency mode.
+
+    friend class Graph;
+    friend class GraphBuilder;
+    friend class ContractionHierarchy;
+    friend class HubLabels;
+    friend class GraphQueries<CsrGraph>;
+
+    // Check whether an index names a vertex of the graph.
+    bool _is_vertex(int idx) const;
+
+    // Get the weight of the first edge from one vertex to another, or -1; both must be vertices.
+    int _edge_weight(int from, int to) const;
+
+    // View the edges leaving vertex u, which must be a vertex.
+    NeighborView _neighbor_view(int u) const;
+
+public:
+
+    // Default constructor to initialize an empty snapshot.
+    CsrGraph();
+
+    // Write the snapshot to a binary file that open() can map. Returns false if the file cannot be written.
+    bool save(const std::string &path) const;
+
+    // Map a file written by save() and answer queries directly from its pages. Only the header is checked
+    // unless verify_checksums is set, which reads the whole file once, comparing checksums and checking that
+    // every offset, target and label slot is in range. Returns false, leaving the snapshot unchanged, if the
+    // file is missing, truncated, corrupt or was written by an incompatible build.
+    bool open(const std::string &path, bool verify_checksums = false);
+
+    // Get the total number of edges in the graph.
+    int num_edges() const;
+
+    // Get the total number of vertices in the graph.
+    int num_verts() const;
+
+    // Sort every vertex's neighbors by index so has_edge and edge_weight binary-search them, and give
+    // vertices with many neighbors a hash index. Snapshots opened from a file start unsorted; if the
+    // file's neighbors are already sorted, only the hash index is built and the mapping is not copied.
+    void sort_adjacency();
+
+    // Check whether the snapshot is in sorted adjacency mode.
+    bool has_sorted_adjacency() const;
+
+    // Call f(neighbor_index, weight) for every edge leaving vertex u.
+    template <typename F>
+    void for_each_neighbor(int u, F f) const
+    {
+        const int *neighbor = targets.data();
+        const int *weight = weights.data();
+        for (int e = offsets[u], end = offsets[u + 1]; e < end; e++)
+        {
+            f(neighbor[e], weight[e]);
+        }
+    }
+
+};
+
+#endif //GRAPHLIB_CSRGRAPH_H
@@ -0,0 +1,176 @@
+#ifndef DARYHEAP_H
+#define DARYHEAP_H
+
+#include <vector>
+#include <stdexcept>
+
+// Indexed min-heap of (key, id) pairs where every node has D children instead of two.
+// A wider node makes the tree shallower and keeps all children of a node in one or two
+// cache lines, which makes _heapify_down cheaper than in the binary IndexedMinHeap.
+// Offers the same interface as IndexedMinHeap, so it can be passed to Dijkstra and Prim.
+template <int D>
+class DaryHeap {
+    static_assert(D >= 2, "A d-ary heap needs at least two children per node");
+
+private:
+    std::vector<std::pair<int, int>> heap;
+    std::vector<int> positions; // Heap position of each id, -1 if the id is not in the heap.
+
+    // Swaps two heap slots and keeps positions in sync.
+    void _swap(int a, int b)
+    {
+        std::swap(heap[a], heap[b]);
+        positions[heap[a].second] = a;
+        positions[heap[b].second] = b;
+    }
+
+    // Helper function to maintain the heap property by moving an element up the heap.
+    void _heapify_up(int index)
+    {
+        while (index > 0)
+        {
+            int parent = (index - 1) / D;
+            if (!(heap[index] < heap[parent]))
+            {
+                break;
+            }
+            _swap(index, parent);
+            index = parent;
+        }
+    }
+
+    // Helper function to maintain the heap property by moving an element down the heap.
+    void _heapify_down(int index)
+    {
+        int n = heap.size();
+        while (true)
+        {
+            int first_child = D * index + 1;
+            int last_child = first_child + D < n ? first_child + D : n;
+            int smallest = index;
+
+            for (int child = first_child; child < last_child; child++)
+            {
+                if (heap[child] < heap[smallest])
+                {
+                    smallest = child;
+                }
+            }
+
+            if (smallest == index)
+            {
+                break; // The heap property is preserved.
+            }
+            _swap(index, smallest);
+            index = smallest;
+        }
+    }
+
+public:
+    // Constructor to create an empty heap for ids in [0, capacity).
+    explicit DaryHeap(int capacity) : positions(capacity, -1)
+    {
+        heap.reserve(capacity);
+    }
+
+    // Inserts a new (key, id) element; the id must not already be in the heap.
+    void insert(std::pair<int, int> element)
+    {
+        if (contains(element.second))
+        {
+            throw std::invalid_argument("Id is already in the heap");
+        }
+        heap.push_back(element);
+        positions[element.second] = heap.size() - 1;
+        _heapify_up(heap.size() - 1);
+    }
+
+    // Lowers the key of an id that is already in the heap.
+    void decrease_key(int id, int key)
+    {
+        if (!contains(id))
+        {
+            throw std::invalid_argument("Id is not in the heap");
+        }
+        if (key > heap[positions[id]].first)
+        {
+            throw std::invalid_argument("New key is larger than the current key");
+        }
+        heap[positions[id]].first = key;
+        _heapify_up(positions[id]);
+    }
+
+    // Inserts the id, or lowers its key if it is already in the heap with a larger one.
+    void insert_or_decrease(int id, int key)
+    {
+        int position = positions[id];
+        if (position == -1)
+        {
+            insert({key, id});
+        }
+        else if (key < heap[position].first)
+        {
+            heap[position].first = key;
+            _heapify_up(position);
+        }
+    }
+
+    // Checks if the id is currently in the heap.
+    bool contains(int id) const
+    {
+        return positions[id] != -1;
+    }
+
+    // Retrieves the minimum element (root) of the heap.
+    std::pair<int, int> get_min() const
+    {
+        if (heap.empty())
+        {
+            throw std::runtime_error("Heap is empty");
+        }
+        return heap[0];
+    }
+
+    // Removes and returns the minimum element (root) from the heap.
+    std::pair<int, int> extract_min()
+    {
+        if (heap.empty())
+        {
+            throw std::runtime_error("Heap is empty");
+        }
+        std::pair<int, int> min_val = heap[0];
+        _swap(0, heap.size() - 1);
+        heap.pop_back();
+        positions[min_val.second] = -1;
+
+        if (!heap.empty())
+        {
+            _heapify_down(0);
+        }
+        return min_val;
+    }
+
+    // Removes every element in O(size), keeping the capacity, so the heap can be reused.
+    void clear()
+    {
+        for (const auto &element : heap)
+        {
+            positions[element.second] = -1;
+        }
+        heap.clear();
+    }
+
+    // Checks if the heap is empty.
+    bool is_empty() const
+    {
+        return heap.empty();
+    }
+
+    // Returns the current size (number of elements) of the heap.
+    int size() const
+    {
+        return heap.size();
+    }
+};
+
+#endif // DARYHEAP_H
@@ -1,27 +1,58 @@
-#include <queue>
 #include "graph.h"
-#include "minHeap.h"
-#include <set>
+#include "graphAlgorithms.h"
+#include <algorithm>
 #include <iostream>
+#include <stdexcept>
 
 
 // Constructor for the Graph class
-Graph::Graph() : number_of_verts(0){}
+Graph::Graph() : number_of_verts(0), sorted_adjacency(false), num_removed(0) {}
 
 /**
- * Adds a new vertex with the specified label to the graph.
+ * Adds a new vertex with the specified label to the graph. A removed vertex with that label is
+ * brought back at its old index.
  *
  * @param label The label of the vertex to be added.
+ * @return The index of the vertex with that label.
  */
-void Graph::add_vertex(const std::string &label)
+int Graph::add_vertex(std::string_view label)
 {
     // Check if the vertex with the given label already exists in the graph.
-    if (vertex_indices.find(label) == vertex_indices.end())
+    int idx = vertex_labels.intern(label);
+    if (idx == number_of_verts)
     {
-        vertex_indices[label] = number_of_verts;
         adj_list.emplace_back();
         number_of_verts++;
     }
+    else if (idx < static_cast<int>(removed.size()) && removed[idx])
+    {
+        removed[idx] = false;
+        num_removed--;
+    }
+    return idx;
+}
+
+/**
+ * Adds vertices for callers that only work with indices. Each new vertex is labelled with its own index.
+ *
+ * @param count The number of vertices to add.
+ * @return The index of the first new vertex.
+ * @throws std::invalid_argument if an existing vertex is already labelled with one of the new indices.
+ */
+int Graph::add_vertices(int count)
+{
+    int first = number_of_verts;
+    adj_list.reserve(number_of_verts + count);
+    for (int i = 0; i < count; i++)
+    {
+        int idx = number_of_verts;
+        std::string label = std::to_string(idx);
+        if (add_vertex(label) != idx)
+        {
+            throw std::invalid_argument("Vertex label already taken: " + label);
+        }
+    }
+    return first;
 }
 
 /**
@@ -32,15 +63,25 @@ void Graph::add_vertex(const std::string &label)
  * @param weight The weight of the edge.
  * @return True if the edge was successfully added, false if either of the vertices doesn't exist.
  */
- bool Graph::add_edge(const std::string &from, const std::string to, int weight)
+ bool Graph::add_edge(std::string_view from, std::string_view to, int weight)
 {
-    if(vertex_indices.find(from) != vertex_indices.end() && vertex_indices.find(to) != vertex_indices.end())
-    {
-        int from_idx = vertex_indices[from];
-        int to_idx = vertex_indices[to];
+    return add_edge(vertex_labels.id_of(from), vertex_labels.id_of(to), weight);
+}
 
-        adj_list[from_idx].emplace_back(to_idx, weight);
-        adj_list[to_idx].emplace_back(from_idx, weight);
+/**
+ * Adds a new edge between two vertices given by index.
+ *
+ * @param from   The index of the source vertex.
+ * @param to     The index of the destination vertex.
+ * @param weight The weight of the edge.
+ * @return True if the edge was successfully added, false if either index is out of range.
+ */
+bool Graph::add_edge(int from, int to, int weight)
+{
+    if (_is_vertex(from) && _is_vertex(to))
+    {
+        _insert_neighbor(from, to, weight);
+        _insert_neighbor(to, from, weight);
 
         return true;
     }
@@ -48,263 +89,481 @@ void Graph::add_vertex(const std::string &label)
 }
 
 /**
- * Counts the total number of edges in the graph.
+ * Private function recording one direction of an edge. In sorted adjacency mode the edge goes after
+ * any existing edges to the same neighbor, so parallel edges keep their insertion order, and once the
+ * vertex reaches AdjacencyIndex::MIN_DEGREE neighbors its edges are entered in the hub index.
  *
- * @return The number of edges in the graph.
+ * @param u      The vertex whose neighbor list receives the edge.
+ * @param v      The neighbor.
+ * @param weight The weight of the edge.
  */
-int Graph::num_edges()
+void Graph::_insert_neighbor(int u, int v, int weight)
 {
-    int num_edges = 0;
-    for (const auto &edges : adj_list)
+    std::vector<std::pair<int, int>> &edges = adj_list[u];
+    if (!sorted_adjacency)
     {
-        num_edges += edges.size();
+        edges.emplace_back(v, weight);
+        return;
+    }
+
+    int position = lower_bound_neighbor(static_cast<int>(edges.size()), v + 1, [&](int i) { return edges[i].first; });
+    edges.emplace(edges.begin() + position, v, weight);
+
+    if (edges.size() == AdjacencyIndex::MIN_DEGREE)
+    {
+        for (const auto &edge : edges)
+        {
+            hub_index.insert(u, edge.first, edge.second);
+        }
+    }
+    else if (edges.size() > AdjacencyIndex::MIN_DEGREE)
+    {
+        hub_index.insert(u, v, weight);
     }
-    return num_edges;
 }
 
 /**
- * Returns the total number of vertices in the graph.
- *
- * @return The number of vertices in the graph.
+ * Sorts every neighbor list by neighbor index, keeping parallel edges in insertion order, and indexes
+ * the edges of every vertex with at least AdjacencyIndex::MIN_DEGREE neighbors. From then on add_edge
+ * inserts edges in order, which costs time proportional to the degree.
  */
- int Graph::num_verts() const
-{
-    return number_of_verts;
-}
-/**
-* Checks if an edge exists between two vertices in the graph.
-*
-* @param from The label of the source vertex.
-* @param to   The label of the destination vertex.
-* @return True if an edge exists between the specified vertices, false otherwise.
-*/
-bool Graph::has_edge(const std::string &from, const std::string to)
+void Graph::sort_adjacency()
 {
-    if (vertex_indices.find(from) != vertex_indices.end() && vertex_indices.find(to) != vertex_indices.end())
+    if (sorted_adjacency)
     {
-        int from_idx = vertex_indices[from];
-        int to_idx = vertex_indices[to];
-
-        for (const auto &edge : adj_list[from_idx])
+        return;
+    }
+    for (int u = 0; u < number_of_verts; u++)
+    {
+        std::vector<std::pair<int, int>> &edges = adj_list[u];
+        std::stable_sort(edges.begin(), edges.end(), [](const std::pair<int, int> &a, const std::pair<int, int> &b)
+        {
+            return a.first < b.first;
+        });
+        if (edges.size() >= AdjacencyIndex::MIN_DEGREE)
         {
-            if (edge.first == to_idx)
+            for (const auto &edge : edges)
             {
-                return true;
+                hub_index.insert(u, edge.first, edge.second);
             }
         }
     }
-    return false;
+    sorted_adjacency = true;
 }
 
 /**
- * Retrieves the weight of an edge between two vertices in the graph.
+ * Checks whether neighbor lists are kept sorted.
  *
- * @param from The label of the source vertex.
- * @param to   The label of the destination vertex.
- * @return The weight of the edge between the specified vertices, or -1 if no such edge exists.
+ * @return True after sort_adjacency() has been called.
+ */
+bool Graph::has_sorted_adjacency() const
+{
+    return sorted_adjacency;
+}
+
+/**
+ * Private function removing one edge from a neighbor list. In sorted adjacency mode the edge is found
+ * by binary search, and if u is indexed as a hub, the index moves on to the next parallel edge to v.
+ *
+ * @param u The vertex whose neighbor list loses the edge.
+ * @param v The neighbor.
+ * @return True if an edge from u to v was removed, false if there was none.
  */
- int Graph::edge_weight(const std::string &from, const std::string to)
+bool Graph::_erase_neighbor(int u, int v)
 {
-    if (vertex_indices.find(from) != vertex_indices.end() && vertex_indices.find(to) != vertex_indices.end())
+    std::vector<std::pair<int, int>> &edges = adj_list[u];
+    int position;
+    if (sorted_adjacency)
+    {
+        position = lower_bound_neighbor(static_cast<int>(edges.size()), v, [&](int i) { return edges[i].first; });
+    }
+    else
+    {
+        position = 0;
+        while (position < static_cast<int>(edges.size()) && edges[position].first != v)
+        {
+            position++;
+        }
+    }
+    if (position == static_cast<int>(edges.size()) || edges[position].first != v)
     {
-        int from_idx = vertex_indices[from];
-        int to_idx = vertex_indices[to];
+        return false;
+    }
+    edges.erase(edges.begin() + position);
 
-        for (const auto &edge : adj_list[from_idx])
+    if (sorted_adjacency)
+    {
+        hub_index.erase(u, v);
+        if (edges.size() >= AdjacencyIndex::MIN_DEGREE && position < static_cast<int>(edges.size()) && edges[position].first == v)
         {
-            if (edge.first == to_idx)
-            {
-                return edge.second;
-            }
+            hub_index.insert(u, v, edges[position].second);
         }
     }
-    return -1;
+    return true;
+}
+
+/**
+ * Removes an edge between two vertices in the graph.
+ *
+ * @param from The label of the source vertex.
+ * @param to   The label of the destination vertex.
+ * @return True if an edge was removed, false if either vertex or the edge doesn't exist.
+ */
+bool Graph::remove_edge(std::string_view from, std::string_view to)
+{
+    return remove_edge(vertex_labels.id_of(from), vertex_labels.id_of(to));
 }
 
 /**
- * Retrieves a vector of connected vertices (neighbors) and their corresponding edge weights for a given vertex.
+ * Removes the first edge added between two vertices given by index, from both neighbor lists. The
+ * remaining edges keep their order, so traversals visit them as if the edge had never been added.
  *
- * @param label The label of the vertex for which connected vertices are to be retrieved.
- * @return A vector of pairs representing connected vertices and their edge weights, or an empty vector if the vertex is not found.
+ * @param from The index of the source vertex.
+ * @param to   The index of the destination vertex.
+ * @return True if an edge was removed, false if either vertex or the edge doesn't exist.
  */
-std::vector<std::pair<int, int> > Graph::get_connected(std::string &label)
+bool Graph::remove_edge(int from, int to)
 {
-    if (vertex_indices.find(label) != vertex_indices.end())
+    if (!_is_vertex(from) || !_is_vertex(to) || !_erase_neighbor(from, to))
     {
-        int idx = vertex_indices[label];
-        return adj_list[idx];
+        return false;
     }
-    return std::vector<std::pair<int, int>>();
+    // A self-loop appears twice in the same list, so this removes its second entry.
+    _erase_neighbor(to, from);
+    return true;
 }
 
-
-
 /**
- * Computes the shortest distances from a source vertex to all other vertices using Dijkstra's algorithm.
+ * Removes a vertex and its edges from the graph.
  *
- * @param source         The label of the source vertex.
- * @param previous_nodes A vector to store the previous node in the shortest path for each vertex.
- * @return A vector of shortest distances from the source to all other vertices.
+ * @param label The label of the vertex to be removed.
+ * @return True if the vertex was removed, false if it doesn't exist.
  */
-std::vector<int> Graph::dijkstra_shortest_distances(const std::string &source, std::vector<int>& previous_nodes)
+bool Graph::remove_vertex(std::string_view label)
 {
-    const int max = std::numeric_limits<int>::max();
-
-    std::vector<int>distances(number_of_verts, max);
-    distances[vertex_indices[source]] = 0;
+    return remove_vertex(vertex_labels.id_of(label));
+}
 
-    std::vector<std::pair<int, int>> initial_data;
-    for (int i = 0; i < number_of_verts; i++)
+/**
+ * Removes a vertex given by index. Its edges are dropped from each neighbor's list in one pass per
+ * neighbor, and the vertex is marked with a tombstone instead of renumbering every later vertex,
+ * which would rewrite every neighbor list; compact() reclaims the index.
+ *
+ * @param idx The index of the vertex to be removed.
+ * @return True if the vertex was removed, false if it doesn't exist.
+ */
+bool Graph::remove_vertex(int idx)
+{
+    if (!_is_vertex(idx))
     {
-        initial_data.push_back({distances[i], i});
+        return false;
     }
-    MinHeap min_heap(initial_data);
 
-    while (!min_heap.is_empty())
+    std::vector<int> neighbors;
+    for (const auto &edge : adj_list[idx])
     {
-        std::pair<int, int> min_distance_vertex = min_heap.extract_min();
-        int u = min_distance_vertex.second;
+        neighbors.push_back(edge.first);
+    }
+    std::sort(neighbors.begin(), neighbors.end());
+    neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
 
-        if (distances[u] < max)
+    for (int v : neighbors)
+    {
+        std::vector<std::pair<int, int>> &edges = adj_list[v];
+        edges.erase(std::remove_if(edges.begin(), edges.end(), [idx](const std::pair<int, int> &edge)
         {
-            for (const auto &edge : adj_list[u]) {
-                int v = edge.first;
-                int weight = edge.second;
-
-                if (distances[u] + weight < distances[v])
-                {
-                    distances[v] = distances[u] + weight;
-                    min_heap.insert({distances[v], v});
-                    previous_nodes[v] = u;
-                }
-            }
-        }
+            return edge.first == idx;
+        }), edges.end());
+        hub_index.erase(v, idx);
+        hub_index.erase(idx, v);
+    }
+    std::vector<std::pair<int, int>>().swap(adj_list[idx]);
+
+    if (static_cast<int>(removed.size()) < number_of_verts)
+    {
+        removed.resize(number_of_verts, false);
     }
-    return distances;
+    removed[idx] = true;
+    num_removed++;
+    return true;
 }
 
 /**
- * Computes and returns the shortest path from a source vertex to a target vertex as a string representation.
+ * Renumbers the graph without its removed vertices. Remaining vertices keep their relative order, so
+ * sorted neighbor lists stay sorted and parallel edges keep their order. The new adjacency lists, label
+ * table and hub index are built next to the old ones and swapped in at the end, so the graph is
+ * unchanged if building them throws.
  *
- * @param source The label of the source vertex.
- * @param target The label of the target vertex.
- * @return A string representation of the shortest path from the source to the target vertex.
+ * @return The new index of every old index, or -1 for a removed vertex.
  */
-std::string Graph::shortest_path(const std::string &source, const std::string &target)
+std::vector<int> Graph::compact()
 {
-    std::vector<int> previous_nodes(number_of_verts, -1);
-    std::vector<int> distances = dijkstra_shortest_distances(source, previous_nodes);
-
-    std::vector<int> path;
-    int current = vertex_indices[target];
-
-    while (current != -1)
+    std::vector<int> new_index(number_of_verts, -1);
+    int count = 0;
+    for (int u = 0; u < number_of_verts; u++)
+    {
+        if (_is_vertex(u))
+        {
+            new_index[u] = count++;
+        }
+    }
+    if (num_removed == 0)
     {
-        path.insert(path.begin(), current);
-        current = previous_nodes[current];
+        return new_index;
     }
 
-    std::string path_string;
-    for (int i = 0; i < path.size(); i++)
+    LabelTable labels;
+    std::vector<std::vector<std::pair<int, int> > > edges(count);
+    AdjacencyIndex index;
+    for (int u = 0; u < number_of_verts; u++)
     {
-        for (const auto& label_idx_pair : vertex_indices)
+        int w = new_index[u];
+        if (w == -1)
         {
-            if (label_idx_pair.second == path[i])
-            {
-                path_string += label_idx_pair.first;
-                break;
-            }
+            continue;
         }
-        if (i < path.size() - 1)
+        labels.intern(vertex_labels.label_of(u));
+        edges[w].reserve(adj_list[u].size());
+        for (const auto &edge : adj_list[u])
         {
-            path_string += " - ";
+            edges[w].emplace_back(new_index[edge.first], edge.second);
+        }
+        if (sorted_adjacency && edges[w].size() >= AdjacencyIndex::MIN_DEGREE)
+        {
+            for (const auto &edge : edges[w])
+            {
+                index.insert(w, edge.first, edge.second);
+            }
         }
     }
 
-    return path_string;
+    number_of_verts = count;
+    adj_list.swap(edges);
+    vertex_labels = std::move(labels);
+    hub_index = std::move(index);
+    removed.clear();
+    num_removed = 0;
+    return new_index;
 }
 
-
 /**
- * Calculates the Minimum Spanning Tree (MST) of the graph using Prim's Algorithm.
+ * Counts the total number of edges in the graph.
  *
- * @param start_label The label of the vertex from which to start building the MST.
- * @return A vector of tuples representing the edges in the MST. Each tuple contains:
- *         - The label of the source vertex.
- *         - The label of the destination vertex.
- *         - The weight of the edge.
+ * @return The number of edges in the graph.
  */
-std::vector<std::tuple<std::string, std::string, int>> Graph::minimum_spanning_tree(const std::string& start_label)
+int Graph::num_edges()
 {
-    // Check if the starting vertex label exists in the graph.
-    if (vertex_indices.find(start_label) == vertex_indices.end())
+    int num_edges = 0;
+    for (const auto &edges : adj_list)
     {
-        std::cerr << "Start vertex label not found in the graph." << std::endl;
-        return {};
+        num_edges += edges.size();
     }
+    return num_edges;
+}
 
-    // Get the index of the starting vertex.
-    int start = vertex_indices[start_label];
+/**
+ * Returns the total number of vertices in the graph.
+ *
+ * @return The number of vertices in the graph.
+ */
+ int Graph::num_verts() const
+{
+    return number_of_verts;
+}
+
+/**
+ * Returns the number of removed vertices still holding an index.
+ *
+ * @return The number of removed vertices since the last compact().
+ */
+int Graph::num_removed_verts() const
+{
+    return num_removed;
+}
 
-    // Initialize the MST and data structures for the algorithm.
-    std::vector<std::tuple<std::string, std::string, int>> mst;
-    MinHeap min_heap;
-    std::set<int> visited;
+/**
+ * Checks whether an index names a vertex that has not been removed.
+ *
+ * @param idx The index to check.
+ * @return True if idx is in [0, num_verts()) and its vertex has not been removed.
+ */
+bool Graph::has_vertex(int idx) const
+{
+    return _is_vertex(idx);
+}
 
-    // Keep track of the current "from" label.
-    std::string fromLabel = start_label;
+/**
+ * Checks whether an index names a vertex of the graph.
+ *
+ * @param idx The index to check.
+ * @return True if idx is in [0, num_verts()) and its vertex has not been removed.
+ */
+bool Graph::_is_vertex(int idx) const
+{
+    return idx >= 0 && idx < number_of_verts && (idx >= static_cast<int>(removed.size()) || !removed[idx]);
+}
 
-    // Insert edges from the starting vertex into the min heap.
-    for (const auto& edge : adj_list[start])
+/**
+ * Private function looking up the weight of an edge, for GraphQueries::edge_weight.
+ *
+ * @param from The index of the source vertex, which must be a vertex.
+ * @param to   The index of the destination vertex, which must be a vertex.
+ * @return The weight of the edge between the specified vertices, or -1 if no such edge exists.
+ */
+int Graph::_edge_weight(int from, int to) const
+{
+    const std::vector<std::pair<int, int>> &edges = adj_list[from];
+    if (sorted_adjacency)
     {
-        min_heap.insert({ edge.second, edge.first });
+        int weight;
+        if (edges.size() >= AdjacencyIndex::MIN_DEGREE)
+        {
+            return hub_index.find(from, to, weight) ? weight : -1;
+        }
+        int position = lower_bound_neighbor(static_cast<int>(edges.size()), to, [&](int i) { return edges[i].first; });
+        return position < static_cast<int>(edges.size()) && edges[position].first == to ? edges[position].second : -1;
     }
 
-    // Mark the starting vertex as visited.
-    visited.insert(start);
-
-    // Prim's Algorithm: Build the MST.
-    while (!min_heap.is_empty())
+    for (const auto &edge : edges)
     {
-        auto [weight, v] = min_heap.extract_min();
+        if (edge.first == to)
+        {
+            return edge.second;
+        }
+    }
+    return -1;
+}
+
+/**
+ * Private function viewing the edges leaving a vertex, for GraphQueries::neighbors. Adding an edge or
+ * vertex may reallocate the neighbor lists, so the view must not be used after the graph is modified.
+ *
+ * @param u The index of the vertex, which must be a vertex.
+ * @return A view of the vertex's (neighbor, weight) edges.
+ */
+NeighborView Graph::_neighbor_view(int u) const
+{
+    return NeighborView(adj_list[u].data(), adj_list[u].size());
+}
 
-        // Skip if the destination vertex has already been visited.
-        if (visited.count(v) > 0)
+/**
+ * Packs the adjacency list into a compressed sparse row snapshot. Neighbor order is preserved,
+ * so every algorithm returns the same result on the snapshot as on the graph it was frozen from.
+ * The snapshot's label table is frozen into a perfect hash, since no labels are added to it later.
+ * A graph in sorted adjacency mode gives a snapshot in sorted adjacency mode, with the same hub index.
+ * Removed vertices keep their indices in the snapshot, as vertices without edges, but their labels are
+ * forgotten, so the snapshot and anything built from it no longer resolve them.
+ *
+ * @return An immutable CSR copy of the graph.
+ */
+CsrGraph Graph::freeze() const
+{
+    CsrGraph csr;
+    csr.number_of_verts = number_of_verts;
+    csr.sorted_adjacency = sorted_adjacency;
+    csr.hub_index = hub_index;
+    csr.vertex_labels = vertex_labels;
+    csr.vertex_labels.freeze();
+    for (int u = 0; u < static_cast<int>(removed.size()); u++)
+    {
+        if (removed[u])
         {
-            continue;
+            csr.vertex_labels.forget(u);
         }
+    }
 
-        // Find the label of the destination vertex using its index.
-        std::string toLabel;
+    std::vector<int> offsets(number_of_verts + 1);
+    offsets[0] = 0;
+    for (int u = 0; u < number_of_verts; u++)
+    {
+        offsets[u + 1] = offsets[u] + static_cast<int>(adj_list[u].size());
+    }
 
-        for (const auto& labelIdxPair : vertex_indices)
+    std::vector<int> targets;
+    std::vector<int> weights;
+    targets.reserve(offsets[number_of_verts]);
+    weights.reserve(offsets[number_of_verts]);
+    for (const auto &edges : adj_list)
+    {
+        for (const auto &edge : edges)
         {
-            if (labelIdxPair.second == v)
-            {
-                toLabel = labelIdxPair.first;
-            }
+            targets.push_back(edge.first);
+            weights.push_back(edge.second);
         }
+    }
+
+    csr.offsets = std::move(offsets);
+    csr.targets = std::move(targets);
+    csr.weights = std::move(weights);
+    return csr;
+}
+
+/**
+ * Writes the graph to a snapshot file. The graph is frozen first, so the file carries the CSR arrays
+ * and a perfect hash of the labels, and CsrGraph::open can map it without building anything.
+ *
+ * @param path The file to write.
+ * @return True if the file was written, false otherwise.
+ */
+bool Graph::save(const std::string &path) const
+{
+    return freeze().save(path);
+}
 
-        // Add the edge to the MST and mark the destination vertex as visited.
-        mst.push_back({ fromLabel, toLabel, weight });
-        visited.insert(v);
+/**
+ * Rebuilds the graph from a snapshot file, copying each vertex's neighbors out of the mapped arrays
+ * into its adjacency vector. The label table keeps viewing the file until a new vertex is added, or
+ * until the labels of removed vertices are restored.
+ *
+ * @param path             The file to read.
+ * @param verify_checksums Whether to check every section of the file against its checksum.
+ * @return True if the graph was loaded, false if the file could not be opened as a snapshot.
+ */
+bool Graph::load(const std::string &path, bool verify_checksums)
+{
+    CsrGraph snapshot;
+    if (!snapshot.open(path, verify_checksums))
+    {
+        return false;
+    }
 
-        // Update the "from" label for the next iteration.
-        fromLabel = toLabel;
+    std::vector<std::vector<std::pair<int, int> > > edges(snapshot.number_of_verts);
+    for (int u = 0; u < snapshot.number_of_verts; u++)
+    {
+        edges[u].reserve(snapshot.offsets[u + 1] - snapshot.offsets[u]);
+        snapshot.for_each_neighbor(u, [&](int v, int weight)
+        {
+            edges[u].emplace_back(v, weight);
+        });
+    }
 
-        // Insert edges from the destination vertex into the min heap.
-        for (const auto& edge : adj_list[v])
+    // Vertices removed before the snapshot was frozen had their labels forgotten. Keep them removed, but
+    // let their labels resolve to their indices again, as in the graph that was saved, so that adding
+    // such a label brings the vertex back at its old index.
+    std::vector<bool> tombstones(snapshot.number_of_verts, false);
+    int num_tombstones = 0;
+    for (int u = 0; u < snapshot.number_of_verts; u++)
+    {
+        if (snapshot.vertex_labels.is_forgotten(u))
         {
-            if (visited.count(edge.first) == 0)
-            {
-                min_heap.insert({ edge.second, edge.first });
-            }
+            tombstones[u] = true;
+            num_tombstones++;
+            snapshot.vertex_labels.restore(u);
         }
     }
 
-    return mst;
+    number_of_verts = snapshot.number_of_verts;
+    adj_list = std::move(edges);
+    vertex_labels = std::move(snapshot.vertex_labels);
+    sorted_adjacency = false;
+    hub_index.clear();
+    removed = num_tombstones > 0 ? std::move(tombstones) : std::vector<bool>();
+    num_removed = num_tombstones;
+    return true;
 }
 
+
+
 /**
  * Displays the Minimum Spanning Tree (MST) of the graph.
  *
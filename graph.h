@@ -4,14 +4,46 @@
 
 #include <vector>
 #include <map>
-
-class Graph {
+#include <string>
+#include <string_view>
+#include <tuple>
+#include "adjacencyIndex.h"
+#include "astarHeuristics.h"
+#include "csrGraph.h"
+#include "graphQueries.h"
+#include "labelTable.h"
+#include "neighborView.h"
+
+// Adjacency-list graph that vertices and edges can be added to and removed from. The label-level queries
+// (paths, distances, spanning trees) come from GraphQueries.
+class Graph : public GraphQueries<Graph> {
 
     int number_of_verts;                                       // Total number of vertices in the graph.
     std::vector<std::vector<std::pair<int, int> > > adj_list;  // Adjacency list for representing edges.
-    std::map<std::string, int> vertex_indices;                 // Mapping of vertex labels to their indices.
+    LabelTable vertex_labels;                                  // Mapping between vertex labels and their indices.
+    bool sorted_adjacency;                                     // Whether neighbor lists are kept sorted by neighbor index.
+    AdjacencyIndex hub_index;                                  // Edges of high-degree vertices, in sorted adjacency mode.
+    std::vector<bool> removed;                                 // Tombstone of each removed vertex, until compact().
+    int num_removed;                                           // Number of tombstones set in removed.
+
+    friend class GraphBuilder;
+    friend class GraphQueries<Graph>;
+
+    // Append u's edge to v to its neighbor list, or insert it in order in sorted adjacency mode.
+    void _insert_neighbor(int u, int v, int weight);
+
+    // Remove u's first edge to v from its neighbor list, keeping the hub index in step.
+    // Returns false if u has no edge to v.
+    bool _erase_neighbor(int u, int v);
+
+    // Check whether an index names a vertex of the graph that has not been removed.
+    bool _is_vertex(int idx) const;
 
+    // Get the weight of the first edge from one vertex to another, or -1; both must be vertices.
+    int _edge_weight(int from, int to) const;
 
+    // View the edges leaving vertex u, which must be a vertex.
+    NeighborView _neighbor_view(int u) const;
 
 public:
 
@@ -19,36 +51,79 @@ public:
     Graph();
 
     // Add a new vertex with the specified label to the graph.
-    void add_vertex(const std::string &label);
+    // Returns the index of the vertex, which is its existing index if the label was already taken.
+    int add_vertex(std::string_view label);
+
+    // Add count vertices labelled with their own indices ("0", "1", ...) and return the first new index.
+    // Throws std::invalid_argument if one of those labels already names another vertex.
+    int add_vertices(int count);
 
     // Add an edge between two vertices with an optional weight (default is 1).
     // Returns true if the edge was successfully added, false if either vertex doesn't exist.
-    bool add_edge(const std::string &from, const std::string to, int weight = 1);
+    bool add_edge(std::string_view from, std::string_view to, int weight = 1);
+    // Same as above, by vertex index.
+    bool add_edge(int from, int to, int weight = 1);
+
+    // Remove the first edge added between two vertices (parallel edges are removed one per call).
+    // Returns true if an edge was removed, false if there is no such edge.
+    bool remove_edge(std::string_view from, std::string_view to);
+    // Same as above, by vertex index.
+    bool remove_edge(int from, int to);
+
+    // Remove a vertex and every edge touching it. The vertex is only marked removed: other vertices keep
+    // their indices, and its index is left unused until compact(). Adding a vertex with the same label
+    // before then brings the index back, without edges. Returns false if there is no such vertex.
+    bool remove_vertex(std::string_view label);
+    // Same as above, by vertex index.
+    bool remove_vertex(int idx);
+
+    // Drop removed vertices and renumber the remaining ones in their current order, so indices are dense
+    // again. Returns the new index of every old index, -1 for removed vertices.
+    std::vector<int> compact();
 
     // Get the total number of edges in the graph.
     int num_edges();
 
-    // Get the total number of vertices in the graph.
+    // Get the total number of vertices in the graph, counting removed vertices until compact().
     int num_verts() const;
 
-    // Check if an edge exists between two vertices.
-    bool has_edge(const std::string &from, const std::string to);
+    // Get the number of removed vertices whose indices compact() has not reclaimed yet.
+    int num_removed_verts() const;
+
+    // Check whether an index names a vertex that has not been removed.
+    bool has_vertex(int idx) const;
+
+    // Sort every neighbor list by neighbor index and keep it sorted as edges are added, so has_edge and
+    // edge_weight binary-search instead of scanning; vertices with many neighbors also get a hash index.
+    // Neighbors are then visited in index order, which can change the pick among equally short paths.
+    void sort_adjacency();
+
+    // Check whether the graph is in sorted adjacency mode.
+    bool has_sorted_adjacency() const;
 
-    // Get the weight of an edge between two vertices.
-    int edge_weight(const std::string &from, const std::string to);
+    // Call f(neighbor_index, weight) for every edge leaving vertex u.
+    template <typename F>
+    void for_each_neighbor(int u, F f) const
+    {
+        for (const auto &edge : adj_list[u])
+        {
+            f(edge.first, edge.second);
+        }
+    }
 
-    // Get a vector of connected vertices for a given vertex label.
-    std::vector<std::pair<int, int> > get_connected(std::string &label);
+    // Pack the graph into an immutable, contiguous CSR snapshot for read-heavy workloads.
+    // Removed vertices are packed as isolated vertices whose labels no longer resolve; compact() first to
+    // leave them out.
+    CsrGraph freeze() const;
 
+    // Write the frozen graph to a snapshot file, see CsrGraph::save. Returns false if the file cannot be written.
+    bool save(const std::string &path) const;
 
-    // Compute the shortest distances from a source vertex using Dijkstra's algorithm.
-    std::vector<int> dijkstra_shortest_distances(const std::string &source, std::vector<int>& previous_nodes);
-    // Find the shortest path between a source and target vertex.
-    std::string shortest_path(const std::string &source, const std::string &target);
+    // Replace the graph with the contents of a snapshot file, see CsrGraph::open. To query a snapshot
+    // without copying it, open it as a CsrGraph instead. Returns false, leaving the graph unchanged, on failure.
+    bool load(const std::string &path, bool verify_checksums = false);
 
 
-    // Compute the Minimum Spanning Tree (MST) starting from a specified vertex label.
-    std::vector<std::tuple<std::string, std::string, int> > minimum_spanning_tree(const std::string &start_label);
     // Display the Minimum Spanning Tree (MST) edges.
     static void display_minimum_spanning_tree(const std::vector<std::tuple<std::string, std::string, int>>& mst);
 
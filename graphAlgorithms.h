@@ -0,0 +1,664 @@
+#ifndef GRAPHLIB_GRAPHALGORITHMS_H
+#define GRAPHLIB_GRAPHALGORITHMS_H
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <vector>
+#include "daryHeap.h"
+#include "indexedMinHeap.h"
+#include "pairingHeap.h"
+#include "queryContext.h"
+#include "radixHeap.h"
+#include "unionFind.h"
+
+// Optional limits for a point-to-point search. Vertices farther than max_distance are never
+// reached, and vertices whose branch of the shortest-distance tree already has max_hops edges are not
+// expanded. max_hops only prunes that tree: it is not a hop-limited shortest path, so a target may be
+// missed even though a longer path with fewer edges would reach it within the limit.
+struct ShortestPathOptions {
+    int max_distance = std::numeric_limits<int>::max();
+    int max_hops = std::numeric_limits<int>::max();   // Edges along the shortest-distance tree, not along any path.
+};
+
+// A minimum spanning forest with one tree per connected component, each rooted at the component's
+// lowest vertex. Components are numbered 0, 1, ... in order of their roots.
+struct SpanningForest {
+    std::vector<std::tuple<int, int, int>> edges;  // (parent, child, weight), parents before their children.
+    std::vector<int> component;                    // Component id of every vertex.
+    std::vector<int> parent;                       // Tree parent of every vertex, -1 for a root.
+    int num_components = 0;
+};
+
+// Algorithm cores shared by every graph representation in the library.
+// A graph type only has to provide:
+//   int num_verts() const;
+//   template <typename F> void for_each_neighbor(int u, F f) const;  // f(neighbor_id, weight)
+//
+// The priority queue is a template policy. Any heap with the interface of IndexedMinHeap works:
+//   explicit Heap(int capacity);
+//   void insert_or_decrease(int id, int key);
+//   std::pair<int, int> extract_min();      // (key, id)
+//   bool is_empty() const;
+// Heaps kept in a BasicQueryContext also need void clear(). Point-to-point searches run on a context;
+// the overloads without one build a throwaway context per call.
+// Shipped policies: IndexedMinHeap, DaryHeap<D>, RadixHeap (Dijkstra only) and PairingHeap.
+namespace graph_algorithms {
+
+/**
+ * Computes the shortest distances from a source vertex to all other vertices using Dijkstra's algorithm.
+ *
+ * @tparam Heap          The priority queue policy.
+ * @param graph          The graph to search.
+ * @param source         The index of the source vertex.
+ * @param previous_nodes A vector to store the previous node in the shortest path for each vertex.
+ * @return A vector of shortest distances from the source to all other vertices.
+ */
+template <typename Heap = IndexedMinHeap, typename G>
+std::vector<int> dijkstra(const G &graph, int source, std::vector<int> &previous_nodes)
+{
+    const int max = std::numeric_limits<int>::max();
+    const int n = graph.num_verts();
+
+    std::vector<int> distances(n, max);
+    distances[source] = 0;
+
+    // Each vertex is in the heap at most once, keyed by its tentative distance.
+    Heap min_heap(n);
+    min_heap.insert_or_decrease(source, 0);
+
+    while (!min_heap.is_empty())
+    {
+        int u = min_heap.extract_min().second;
+
+        graph.for_each_neighbor(u, [&](int v, int weight)
+        {
+            if (distances[u] + weight < distances[v])
+            {
+                distances[v] = distances[u] + weight;
+                min_heap.insert_or_decrease(v, distances[v]);
+                previous_nodes[v] = u;
+            }
+        });
+    }
+    return distances;
+}
+
+/**
+ * Computes the shortest distances from a source vertex to all other vertices using Dijkstra's algorithm,
+ * keeping the results in a reusable context instead of fresh vectors.
+ *
+ * @tparam Heap    The priority queue policy of the context.
+ * @param graph    The graph to search.
+ * @param source   The index of the source vertex.
+ * @param context  Receives the distance and previous node of every vertex on side 0.
+ */
+template <typename Heap, typename G>
+void dijkstra(const G &graph, int source, BasicQueryContext<Heap> &context)
+{
+    context.prepare(graph.num_verts());
+    context.set(source, 0, -1);
+
+    Heap &min_heap = context.heap();
+    min_heap.insert_or_decrease(source, 0);
+
+    while (!min_heap.is_empty())
+    {
+        auto [du, u] = min_heap.extract_min();
+
+        graph.for_each_neighbor(u, [&](int v, int weight)
+        {
+            if (du + weight < context.distance(v))
+            {
+                context.set(v, du + weight, u);
+                min_heap.insert_or_decrease(v, du + weight);
+            }
+        });
+    }
+}
+
+/**
+ * Walks the previous-node chain of one side of a search back from a vertex and appends it to the
+ * context's path, ending at that vertex.
+ *
+ * @param context The context holding the finished search.
+ * @param target  The index of the vertex the path ends at.
+ * @param side    The side of the search to follow.
+ */
+template <typename Heap>
+void unwind_path(BasicQueryContext<Heap> &context, int target, int side = 0)
+{
+    std::vector<int> &path = context.path();
+    size_t start = path.size();
+    for (int current = target; current != -1; current = context.previous(current, side))
+    {
+        path.push_back(current);
+    }
+    std::reverse(path.begin() + start, path.end());
+}
+
+/**
+ * Runs Dijkstra's algorithm from source until target is settled or the search limits are exhausted.
+ * Hops are counted along the shortest-distance tree the search builds, and a vertex at max_hops is
+ * settled but not expanded. This prunes the tree; it does not find the shortest path among those with
+ * at most max_hops edges.
+ *
+ * @tparam Heap    The priority queue policy of the context.
+ * @param graph    The graph to search.
+ * @param source   The index of the source vertex.
+ * @param target   The index of the target vertex.
+ * @param context  The reusable search buffers; its path receives the path to target, empty if it was not reached.
+ * @param options  The distance bound and hop limit of the search.
+ * @return The distance from source to target, or std::numeric_limits<int>::max() if it was not reached.
+ */
+template <typename Heap, typename G>
+int dijkstra_to_target(const G &graph, int source, int target, BasicQueryContext<Heap> &context,
+                       const ShortestPathOptions &options = ShortestPathOptions())
+{
+    context.prepare(graph.num_verts());
+    context.set(source, 0, -1);
+
+    Heap &min_heap = context.heap();
+    min_heap.insert_or_decrease(source, 0);
+
+    while (!min_heap.is_empty())
+    {
+        auto [du, u] = min_heap.extract_min();
+        if (u == target)
+        {
+            unwind_path(context, target);
+            return du;
+        }
+        int hops = context.hops(u);
+        if (hops >= options.max_hops)
+        {
+            continue;
+        }
+
+        graph.for_each_neighbor(u, [&](int v, int weight)
+        {
+            int candidate = du + weight;
+            if (candidate < context.distance(v) && candidate <= options.max_distance)
+            {
+                context.set(v, candidate, u, hops + 1);
+                min_heap.insert_or_decrease(v, candidate);
+            }
+        });
+    }
+    return std::numeric_limits<int>::max();
+}
+
+/**
+ * Computes the shortest path between source and target by growing one Dijkstra search from each end.
+ * Graph edges are symmetric, so the backward search runs on the same adjacency as the forward one.
+ * The search stops once the two smallest tentative distances add up to at least the best meeting
+ * distance found so far, which usually settles far fewer vertices than a one-sided search.
+ *
+ * @tparam Heap    The priority queue policy of the context; it must also provide get_min().
+ * @param graph    The graph to search.
+ * @param source   The index of the source vertex.
+ * @param target   The index of the target vertex.
+ * @param context  The reusable search buffers; its path receives the path from source to target, empty if unreachable.
+ * @return The distance from source to target, or std::numeric_limits<int>::max() if it is unreachable.
+ */
+template <typename Heap, typename G>
+int bidirectional_dijkstra(const G &graph, int source, int target, BasicQueryContext<Heap> &context)
+{
+    const int max = std::numeric_limits<int>::max();
+
+    context.prepare(graph.num_verts());
+    if (source == target)
+    {
+        context.path().push_back(source);
+        return 0;
+    }
+
+    // Side 0 is the search from the source, side 1 the search from the target.
+    context.set(source, 0, -1, 0, 0);
+    context.set(target, 0, -1, 0, 1);
+    context.heap(0).insert_or_decrease(source, 0);
+    context.heap(1).insert_or_decrease(target, 0);
+
+    long long best = max;
+    int meeting = -1;
+
+    while (!context.heap(0).is_empty() && !context.heap(1).is_empty())
+    {
+        int top_forward = context.heap(0).get_min().first;
+        int top_backward = context.heap(1).get_min().first;
+        if (static_cast<long long>(top_forward) + top_backward >= best)
+        {
+            break;
+        }
+
+        int side = top_forward <= top_backward ? 0 : 1;
+        auto [du, u] = context.heap(side).extract_min();
+
+        graph.for_each_neighbor(u, [&](int v, int weight)
+        {
+            int dv = context.distance(v, side);
+            if (du + weight < dv)
+            {
+                dv = du + weight;
+                context.set(v, dv, u, 0, side);
+                context.heap(side).insert_or_decrease(v, dv);
+            }
+            int other = context.distance(v, 1 - side);
+            if (other != max && static_cast<long long>(dv) + other < best)
+            {
+                best = static_cast<long long>(dv) + other;
+                meeting = v;
+            }
+        });
+    }
+
+    if (meeting == -1)
+    {
+        return max;
+    }
+
+    unwind_path(context, meeting);
+    for (int current = context.previous(meeting, 1); current != -1; current = context.previous(current, 1))
+    {
+        context.path().push_back(current);
+    }
+    return static_cast<int>(best);
+}
+
+/**
+ * Same as above, with throwaway buffers.
+ *
+ * @tparam Heap  The priority queue policy; it must also provide get_min().
+ * @param path   Receives the vertex indices of the path from source to target, empty if unreachable.
+ */
+template <typename Heap = IndexedMinHeap, typename G>
+int bidirectional_dijkstra(const G &graph, int source, int target, std::vector<int> &path)
+{
+    BasicQueryContext<Heap> context;
+    int distance = bidirectional_dijkstra(graph, source, target, context);
+    path.swap(context.path());
+    return distance;
+}
+
+/**
+ * Computes the shortest path between source and target with A* search. The heap is keyed by the
+ * distance from the source plus heuristic(v, target), an estimate of the remaining distance.
+ * The result is exact for any admissible heuristic (one that never overestimates); a vertex whose
+ * distance improves after it was extracted is simply queued again.
+ *
+ * @tparam Heap      The priority queue policy of the context.
+ * @param graph      The graph to search.
+ * @param source     The index of the source vertex.
+ * @param target     The index of the target vertex.
+ * @param heuristic  A callable int(int vertex, int target) giving a lower bound on their distance.
+ * @param context    The reusable search buffers; its path receives the path from source to target, empty if unreachable.
+ * @return The distance from source to target, or std::numeric_limits<int>::max() if it is unreachable.
+ */
+template <typename Heap, typename G, typename H>
+int astar(const G &graph, int source, int target, const H &heuristic, BasicQueryContext<Heap> &context)
+{
+    context.prepare(graph.num_verts());
+    context.set(source, 0, -1);
+
+    Heap &min_heap = context.heap();
+    min_heap.insert_or_decrease(source, heuristic(source, target));
+
+    while (!min_heap.is_empty())
+    {
+        int u = min_heap.extract_min().second;
+        int du = context.distance(u);
+        if (u == target)
+        {
+            unwind_path(context, target);
+            return du;
+        }
+
+        graph.for_each_neighbor(u, [&](int v, int weight)
+        {
+            if (du + weight < context.distance(v))
+            {
+                context.set(v, du + weight, u);
+                min_heap.insert_or_decrease(v, du + weight + heuristic(v, target));
+            }
+        });
+    }
+    return std::numeric_limits<int>::max();
+}
+
+/**
+ * Same as above, with throwaway buffers.
+ *
+ * @tparam Heap  The priority queue policy.
+ * @param path   Receives the vertex indices of the path from source to target, empty if unreachable.
+ */
+template <typename Heap = IndexedMinHeap, typename G, typename H>
+int astar(const G &graph, int source, int target, const H &heuristic, std::vector<int> &path)
+{
+    BasicQueryContext<Heap> context;
+    int distance = astar(graph, source, target, heuristic, context);
+    path.swap(context.path());
+    return distance;
+}
+
+/**
+ * Calculates the Minimum Spanning Tree (MST) of the component containing start using Prim's Algorithm.
+ *
+ * @tparam Heap The priority queue policy; monotone heaps such as RadixHeap are rejected.
+ * @param graph The graph to span.
+ * @param start The index of the vertex from which to start building the MST.
+ * @return The MST edges as (parent index, child index, weight) in the order they were added, where the
+ *         parent is the tree vertex the child was joined to.
+ */
+template <typename Heap = IndexedMinHeap, typename G>
+std::vector<std::tuple<int, int, int>> prim(const G &graph, int start)
+{
+    static_assert(!is_monotone_heap<Heap>::value, "Prim extracts edge weights out of order and needs a general heap");
+
+    const int n = graph.num_verts();
+
+    std::vector<std::tuple<int, int, int>> mst;
+    std::vector<bool> visited(n, false);
+    std::vector<int> lightest(n, std::numeric_limits<int>::max());
+    std::vector<int> parents(n, -1);
+
+    // Each unvisited vertex is in the heap at most once, keyed by its lightest edge into the tree,
+    // and parents records the tree vertex at the other end of that edge.
+    Heap min_heap(n);
+    auto join = [&](int u)
+    {
+        visited[u] = true;
+        graph.for_each_neighbor(u, [&](int v, int weight)
+        {
+            if (!visited[v] && weight < lightest[v])
+            {
+                lightest[v] = weight;
+                parents[v] = u;
+                min_heap.insert_or_decrease(v, weight);
+            }
+        });
+    };
+
+    join(start);
+    while (!min_heap.is_empty())
+    {
+        auto [weight, v] = min_heap.extract_min();
+        mst.emplace_back(parents[v], v, weight);
+        join(v);
+    }
+    return mst;
+}
+
+/**
+ * Collects every edge of an undirected graph once, as (from index, to index, weight) with from < to.
+ * Self-loops are dropped, since they never belong to a spanning tree.
+ *
+ * @param graph The graph to read.
+ * @return The edges in adjacency order.
+ */
+template <typename G>
+std::vector<std::tuple<int, int, int>> undirected_edges(const G &graph)
+{
+    std::vector<std::tuple<int, int, int>> edges;
+    for (int u = 0; u < graph.num_verts(); u++)
+    {
+        graph.for_each_neighbor(u, [&](int v, int weight)
+        {
+            if (u < v)
+            {
+                edges.emplace_back(u, v, weight);
+            }
+        });
+    }
+    return edges;
+}
+
+/**
+ * Sorts edges by weight with a stable least-significant-digit radix sort over 8-bit digits. Digits on
+ * which all weights agree are skipped, so small weight ranges take one or two passes.
+ *
+ * @param first   The first edge to sort.
+ * @param last    One past the last edge to sort.
+ * @param scratch A buffer the sort may resize and use; reusing it across calls avoids reallocating.
+ */
+inline void radix_sort_by_weight(std::tuple<int, int, int> *first, std::tuple<int, int, int> *last,
+                                 std::vector<std::tuple<int, int, int>> &scratch)
+{
+    const size_t count = last - first;
+    if (count < 2)
+    {
+        return;
+    }
+    scratch.resize(std::max(scratch.size(), count));
+
+    // Flipping the sign bit orders negative weights before positive ones as unsigned keys.
+    auto digit = [](const std::tuple<int, int, int> &edge, int shift)
+    {
+        return ((static_cast<uint32_t>(std::get<2>(edge)) ^ 0x80000000u) >> shift) & 0xffu;
+    };
+
+    std::tuple<int, int, int> *from = first;
+    std::tuple<int, int, int> *to = scratch.data();
+    for (int shift = 0; shift < 32; shift += 8)
+    {
+        size_t positions[257] = {};
+        for (size_t i = 0; i < count; i++)
+        {
+            positions[digit(from[i], shift) + 1]++;
+        }
+        if (positions[digit(from[0], shift) + 1] == count)
+        {
+            continue;
+        }
+        for (int d = 0; d < 256; d++)
+        {
+            positions[d + 1] += positions[d];
+        }
+        for (size_t i = 0; i < count; i++)
+        {
+            to[positions[digit(from[i], shift)]++] = from[i];
+        }
+        std::swap(from, to);
+    }
+    if (from != first)
+    {
+        std::copy(from, from + count, first);
+    }
+}
+
+/**
+ * Calculates a minimum spanning forest with Kruskal's algorithm: the edges are radix-sorted by weight
+ * and each one joins the forest if a union-find shows that its endpoints are still in different trees.
+ *
+ * @param graph The graph to span.
+ * @return The forest edges as (from index, to index, weight) with from < to, in increasing weight
+ *         order, one tree per connected component. Edges of equal weight are taken in adjacency order.
+ */
+template <typename G>
+std::vector<std::tuple<int, int, int>> kruskal(const G &graph)
+{
+    const int n = graph.num_verts();
+
+    std::vector<std::tuple<int, int, int>> edges = undirected_edges(graph);
+    std::vector<std::tuple<int, int, int>> scratch;
+    radix_sort_by_weight(edges.data(), edges.data() + edges.size(), scratch);
+
+    std::vector<std::tuple<int, int, int>> forest;
+    UnionFind trees(n);
+    for (const auto &edge : edges)
+    {
+        if (static_cast<int>(forest.size()) == n - 1)
+        {
+            break;
+        }
+        if (trees.unite(std::get<0>(edge), std::get<1>(edge)))
+        {
+            forest.push_back(edge);
+        }
+    }
+    return forest;
+}
+
+// Number of edges below which Filter-Kruskal sorts a range instead of partitioning it further.
+const size_t FILTER_KRUSKAL_BASE_EDGES = 1 << 12;
+
+/**
+ * Recursive step of Filter-Kruskal over the edges [first, last). The range is split around a pivot
+ * weight; the light half is handled first, after which every heavy edge whose endpoints are already
+ * connected is filtered out before the heavy half is handled.
+ *
+ * @param first   The first edge of the range; the range is reordered.
+ * @param last    One past the last edge of the range.
+ * @param trees   The union-find of the forest built so far.
+ * @param forest  Receives the forest edges in increasing weight order.
+ * @param scratch A buffer for radix_sort_by_weight.
+ * @param target  The number of forest edges after which no edge can join anymore.
+ */
+template <typename Edge>
+void filter_kruskal_range(Edge *first, Edge *last, UnionFind &trees, std::vector<Edge> &forest,
+                          std::vector<Edge> &scratch, size_t target)
+{
+    if (forest.size() >= target || first == last)
+    {
+        return;
+    }
+
+    Edge *middle = last;
+    if (static_cast<size_t>(last - first) > FILTER_KRUSKAL_BASE_EDGES)
+    {
+        // The median of a few evenly spaced samples keeps the halves balanced on typical inputs.
+        const size_t count = last - first;
+        int samples[9];
+        for (int i = 0; i < 9; i++)
+        {
+            samples[i] = std::get<2>(first[count * (2 * i + 1) / 18]);
+        }
+        std::nth_element(samples, samples + 4, samples + 9);
+        int pivot = samples[4];
+
+        middle = std::partition(first, last, [&](const Edge &edge) { return std::get<2>(edge) <= pivot; });
+        if (middle == last)
+        {
+            middle = std::partition(first, last, [&](const Edge &edge) { return std::get<2>(edge) < pivot; });
+        }
+    }
+
+    if (middle == last || middle == first)
+    {
+        // A small range, or one whose weights are all equal: sort it and scan it like Kruskal.
+        radix_sort_by_weight(first, last, scratch);
+        for (Edge *edge = first; edge != last && forest.size() < target; edge++)
+        {
+            if (trees.unite(std::get<0>(*edge), std::get<1>(*edge)))
+            {
+                forest.push_back(*edge);
+            }
+        }
+        return;
+    }
+
+    filter_kruskal_range(first, middle, trees, forest, scratch, target);
+    if (forest.size() >= target)
+    {
+        return;
+    }
+    Edge *kept = std::partition(middle, last, [&](const Edge &edge)
+    {
+        return trees.find(std::get<0>(edge)) != trees.find(std::get<1>(edge));
+    });
+    filter_kruskal_range(middle, kept, trees, forest, scratch, target);
+}
+
+/**
+ * Calculates a minimum spanning forest with Filter-Kruskal. Edges are partitioned around pivot weights
+ * like quicksort, and heavy edges that would close a cycle are discarded before they are ever sorted,
+ * which saves most of the sorting work on graphs with many more edges than vertices.
+ *
+ * @param graph The graph to span.
+ * @return The forest edges as (from index, to index, weight) with from < to, in increasing weight order.
+ *         The total weight equals kruskal's; among edges of equal weight a different choice may be made.
+ */
+template <typename G>
+std::vector<std::tuple<int, int, int>> filter_kruskal(const G &graph)
+{
+    const int n = graph.num_verts();
+
+    std::vector<std::tuple<int, int, int>> edges = undirected_edges(graph);
+    std::vector<std::tuple<int, int, int>> scratch;
+    std::vector<std::tuple<int, int, int>> forest;
+    UnionFind trees(n);
+    filter_kruskal_range(edges.data(), edges.data() + edges.size(), trees, forest, scratch, n > 0 ? n - 1 : 0);
+    return forest;
+}
+
+/**
+ * Calculates a minimum spanning forest of every component and orients it. The forest comes from one
+ * Filter-Kruskal pass over the edges; each tree is then walked breadth-first from the lowest vertex of
+ * its component, which numbers the components and gives every edge its true parent.
+ *
+ * @param graph The graph to span.
+ * @return The oriented forest with component ids and parents.
+ */
+template <typename G>
+SpanningForest minimum_spanning_forest(const G &graph)
+{
+    const int n = graph.num_verts();
+    std::vector<std::tuple<int, int, int>> tree_edges = filter_kruskal(graph);
+
+    // Adjacency of the forest alone, in CSR form.
+    std::vector<int> offsets(n + 1, 0);
+    for (const auto &edge : tree_edges)
+    {
+        offsets[std::get<0>(edge) + 1]++;
+        offsets[std::get<1>(edge) + 1]++;
+    }
+    for (int v = 0; v < n; v++)
+    {
+        offsets[v + 1] += offsets[v];
+    }
+    std::vector<std::pair<int, int>> neighbors(offsets[n]);
+    std::vector<int> next(offsets.begin(), offsets.end() - 1);
+    for (const auto &[u, v, weight] : tree_edges)
+    {
+        neighbors[next[u]++] = {v, weight};
+        neighbors[next[v]++] = {u, weight};
+    }
+
+    SpanningForest forest;
+    forest.edges.reserve(tree_edges.size());
+    forest.component.assign(n, -1);
+    forest.parent.assign(n, -1);
+
+    std::vector<int> queue;
+    queue.reserve(n);
+    for (int root = 0; root < n; root++)
+    {
+        if (forest.component[root] != -1)
+        {
+            continue;
+        }
+        int id = forest.num_components++;
+        forest.component[root] = id;
+        queue.assign(1, root);
+        for (size_t head = 0; head < queue.size(); head++)
+        {
+            int u = queue[head];
+            for (int i = offsets[u]; i < offsets[u + 1]; i++)
+            {
+                auto [v, weight] = neighbors[i];
+                if (forest.component[v] == -1)
+                {
+                    forest.component[v] = id;
+                    forest.parent[v] = u;
+                    forest.edges.emplace_back(u, v, weight);
+                    queue.push_back(v);
+                }
+            }
+        }
+    }
+    return forest;
+}
+
+} // namespace graph_algorithms
+
+#endif //GRAPHLIB_GRAPHALGORITHMS_H
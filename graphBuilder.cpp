@@ -0,0 +1,438 @@
+#include "graphBuilder.h"
+#include "labelShards.h"
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+
+// Number of label edges interned per round, which bounds the scratch memory of a large batch.
+const size_t INTERN_CHUNK_EDGES = 1 << 22;
+
+// Split [0, count) into one contiguous range per thread and run body(thread_index, begin, end) on each.
+template <typename F>
+void for_each_range(ThreadPool &pool, size_t count, F body)
+{
+    size_t num_threads = pool.num_threads();
+    pool.run_on_all([&](int thread_index)
+    {
+        size_t begin = count * thread_index / num_threads;
+        size_t end = count * (thread_index + 1) / num_threads;
+        body(thread_index, begin, end);
+    });
+}
+
+} // namespace
+
+
+// Constructor for the GraphBuilder class
+GraphBuilder::GraphBuilder() : number_of_verts(0) {}
+
+/**
+ * Returns the total number of vertices added so far, including those added by label batches.
+ *
+ * @return The number of vertices.
+ */
+int GraphBuilder::num_verts() const
+{
+    return number_of_verts;
+}
+
+/**
+ * Looks up the index of a vertex.
+ *
+ * @param label The label of the vertex.
+ * @return The index of the vertex, or -1 if no vertex has that label.
+ */
+int GraphBuilder::id_of(std::string_view label) const
+{
+    return vertex_labels.id_of(label);
+}
+
+/**
+ * Reserves room for edges that later batches will add, so the edge arrays grow only once.
+ *
+ * @param count The total number of edges expected.
+ */
+void GraphBuilder::reserve_edges(size_t count)
+{
+    edge_sources.reserve(count);
+    edge_targets.reserve(count);
+    edge_weights.reserve(count);
+}
+
+/**
+ * Adds a new vertex with the specified label.
+ *
+ * @param label The label of the vertex to be added.
+ * @return The index of the vertex with that label.
+ */
+int GraphBuilder::add_vertex(std::string_view label)
+{
+    int idx = vertex_labels.intern(label);
+    if (idx == number_of_verts)
+    {
+        number_of_verts++;
+    }
+    return idx;
+}
+
+/**
+ * Adds vertices for callers that only work with indices. Each new vertex is labelled with its own index.
+ *
+ * @param count The number of vertices to add.
+ * @return The index of the first new vertex.
+ * @throws std::invalid_argument if an existing vertex is already labelled with one of the new indices.
+ */
+int GraphBuilder::add_vertices(int count)
+{
+    int first = number_of_verts;
+    for (int i = 0; i < count; i++)
+    {
+        int idx = number_of_verts;
+        std::string label = std::to_string(idx);
+        if (add_vertex(label) != idx)
+        {
+            throw std::invalid_argument("Vertex label already taken: " + label);
+        }
+    }
+    return first;
+}
+
+/**
+ * Adds one edge between two vertices given by index.
+ *
+ * @param from   The index of the source vertex.
+ * @param to     The index of the destination vertex.
+ * @param weight The weight of the edge.
+ * @return True if the edge was added, false if either index is out of range.
+ */
+bool GraphBuilder::add_edge(int from, int to, int weight)
+{
+    if (from < 0 || from >= number_of_verts || to < 0 || to >= number_of_verts)
+    {
+        return false;
+    }
+    edge_sources.push_back(from);
+    edge_targets.push_back(to);
+    edge_weights.push_back(weight);
+    return true;
+}
+
+/**
+ * Adds a batch of edges between vertices given by index. The batch is checked before anything is added,
+ * so a bad index leaves the builder unchanged.
+ *
+ * @param edges The edges as (from index, to index, weight).
+ * @return True if the edges were added, false if any index is out of range.
+ */
+bool GraphBuilder::add_edges(const std::vector<std::tuple<int, int, int>> &edges)
+{
+    for (const auto &edge : edges)
+    {
+        int from = std::get<0>(edge);
+        int to = std::get<1>(edge);
+        if (from < 0 || from >= number_of_verts || to < 0 || to >= number_of_verts)
+        {
+            return false;
+        }
+    }
+
+    reserve_edges(edge_sources.size() + edges.size());
+    for (const auto &edge : edges)
+    {
+        edge_sources.push_back(std::get<0>(edge));
+        edge_targets.push_back(std::get<1>(edge));
+        edge_weights.push_back(std::get<2>(edge));
+    }
+    return true;
+}
+
+/**
+ * Adds a batch of edges between vertices given by label. Labels not seen before become new vertices,
+ * numbered in the order they first appear in the batch (the from label of an edge before its to label).
+ *
+ * @param edges The edges as (from label, to label, weight).
+ * @param pool  The threads to intern the labels on.
+ */
+void GraphBuilder::add_edges(const std::vector<std::tuple<std::string_view, std::string_view, int>> &edges, ThreadPool &pool)
+{
+    reserve_edges(edge_sources.size() + edges.size());
+
+    std::vector<std::string_view> labels;
+    std::vector<int> indices;
+    for (size_t chunk = 0; chunk < edges.size(); chunk += INTERN_CHUNK_EDGES)
+    {
+        size_t chunk_end = std::min(edges.size(), chunk + INTERN_CHUNK_EDGES);
+
+        labels.clear();
+        for (size_t e = chunk; e < chunk_end; e++)
+        {
+            labels.push_back(std::get<0>(edges[e]));
+            labels.push_back(std::get<1>(edges[e]));
+        }
+        _intern_chunk(labels, indices, pool);
+
+        for (size_t e = chunk; e < chunk_end; e++)
+        {
+            edge_sources.push_back(indices[2 * (e - chunk)]);
+            edge_targets.push_back(indices[2 * (e - chunk) + 1]);
+            edge_weights.push_back(std::get<2>(edges[e]));
+        }
+    }
+}
+
+/**
+ * Adds a batch of edges between vertices given by label.
+ *
+ * @param edges The edges as (from label, to label, weight).
+ * @param pool  The threads to intern the labels on.
+ */
+void GraphBuilder::add_edges(const std::vector<std::tuple<std::string, std::string, int>> &edges, ThreadPool &pool)
+{
+    std::vector<std::tuple<std::string_view, std::string_view, int>> views;
+    views.reserve(edges.size());
+    for (const auto &edge : edges)
+    {
+        views.emplace_back(std::get<0>(edge), std::get<1>(edge), std::get<2>(edge));
+    }
+    add_edges(views, pool);
+}
+
+/**
+ * Private function resolving a chunk of endpoint labels to vertex indices.
+ *
+ * Labels are hashed in parallel and bucketed by shard with a stable counting sort, one histogram per
+ * thread, so every thread then walks only the labels of its own shard, in chunk order. It looks them up
+ * in the builder's table and interns the unknown ones in a table of its own, marking the first
+ * occurrence of each. A sequential pass over the first occurrences hands out vertex indices in order of
+ * appearance, and a final parallel pass rewrites the shard-local ids to those indices.
+ *
+ * @param labels  The endpoint labels, in edge order.
+ * @param indices Receives the vertex index of every label.
+ * @param pool    The threads to run on.
+ */
+void GraphBuilder::_intern_chunk(const std::vector<std::string_view> &labels, std::vector<int> &indices, ThreadPool &pool)
+{
+    const size_t count = labels.size();
+    const size_t num_shards = pool.num_threads();
+
+    std::vector<size_t> hashes(count);
+    std::vector<int> shard_ids(count);
+    std::vector<std::vector<size_t>> shard_counts(num_shards);
+    for_each_range(pool, count, [&](int thread_index, size_t begin, size_t end)
+    {
+        std::vector<size_t> &shard_count = shard_counts[thread_index];
+        shard_count.assign(num_shards, 0);
+        for (size_t i = begin; i < end; i++)
+        {
+            hashes[i] = LabelTable::hash(labels[i]);
+            shard_ids[i] = static_cast<int>(label_shards::shard_of(hashes[i], num_shards));
+            shard_count[shard_ids[i]]++;
+        }
+    });
+
+    // Turn the counts into each thread's starting position within each shard's bucket.
+    std::vector<size_t> bucket_starts(num_shards + 1, 0);
+    size_t running = 0;
+    for (size_t shard = 0; shard < num_shards; shard++)
+    {
+        bucket_starts[shard] = running;
+        for (size_t t = 0; t < num_shards; t++)
+        {
+            size_t shard_count = shard_counts[t][shard];
+            shard_counts[t][shard] = running;
+            running += shard_count;
+        }
+    }
+    bucket_starts[num_shards] = running;
+
+    std::vector<size_t> buckets(count);
+    for_each_range(pool, count, [&](int thread_index, size_t begin, size_t end)
+    {
+        std::vector<size_t> &position = shard_counts[thread_index];
+        for (size_t i = begin; i < end; i++)
+        {
+            buckets[position[shard_ids[i]]++] = i;
+        }
+    });
+
+    // A known label resolves to its vertex index; a new one to -(shard-local id + 1).
+    indices.resize(count);
+    std::vector<char> first_occurrence(count, 0);
+    std::vector<LabelTable> shards(num_shards);
+    pool.run_on_all([&](int shard)
+    {
+        LabelTable &table = shards[shard];
+        for (size_t b = bucket_starts[shard]; b < bucket_starts[shard + 1]; b++)
+        {
+            size_t i = buckets[b];
+            int idx = vertex_labels.id_of(labels[i], hashes[i]);
+            if (idx == -1)
+            {
+                int new_id = table.size();
+                int local = table.intern(labels[i], hashes[i]);
+                first_occurrence[i] = local == new_id;
+                idx = -(local + 1);
+            }
+            indices[i] = idx;
+        }
+    });
+
+    std::vector<std::vector<int>> shard_indices(num_shards);
+    for (size_t shard = 0; shard < num_shards; shard++)
+    {
+        shard_indices[shard].resize(shards[shard].size());
+    }
+    for (size_t i = 0; i < count; i++)
+    {
+        if (first_occurrence[i])
+        {
+            shard_indices[shard_ids[i]][-indices[i] - 1] = vertex_labels.intern(labels[i], hashes[i]);
+            number_of_verts++;
+        }
+    }
+
+    for_each_range(pool, count, [&](int, size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; i++)
+        {
+            if (indices[i] < 0)
+            {
+                indices[i] = shard_indices[shard_ids[i]][-indices[i] - 1];
+            }
+        }
+    });
+}
+
+/**
+ * Private function laying the edges out in CSR form with a parallel, stable counting sort. Each edge
+ * u - v becomes the entries u -> v and v -> u. Every thread counts the endpoints of its own range of
+ * edges; turning those counts into per-thread starting positions within each vertex keeps the entries
+ * of every vertex in edge order, matching a Graph filled with add_edge.
+ *
+ * @param pool    The threads to run on.
+ * @param offsets Receives the start of each vertex's neighbors, number_of_verts + 1 entries.
+ * @param targets Receives the neighbor of every entry.
+ * @param weights Receives the weight of every entry.
+ * @throws std::overflow_error if the entries do not fit in int offsets.
+ */
+void GraphBuilder::_sort_edges(ThreadPool &pool, std::vector<int> &offsets, std::vector<int> &targets, std::vector<int> &weights) const
+{
+    const int n = number_of_verts;
+    const size_t num_threads = pool.num_threads();
+    if (edge_sources.size() > static_cast<size_t>(std::numeric_limits<int>::max()) / 2)
+    {
+        throw std::overflow_error("Too many edges for a CSR graph");
+    }
+
+    std::vector<std::vector<int>> counts(num_threads);
+    for_each_range(pool, edge_sources.size(), [&](int thread_index, size_t begin, size_t end)
+    {
+        std::vector<int> &count = counts[thread_index];
+        count.assign(n, 0);
+        for (size_t e = begin; e < end; e++)
+        {
+            count[edge_sources[e]]++;
+            count[edge_targets[e]]++;
+        }
+    });
+
+    // Turn each thread's count into its starting position within the vertex, and sum the degrees.
+    offsets.assign(n + 1, 0);
+    for_each_range(pool, n, [&](int, size_t begin, size_t end)
+    {
+        for (size_t v = begin; v < end; v++)
+        {
+            int running = 0;
+            for (size_t t = 0; t < num_threads; t++)
+            {
+                int count = counts[t][v];
+                counts[t][v] = running;
+                running += count;
+            }
+            offsets[v + 1] = running;
+        }
+    });
+    for (int v = 0; v < n; v++)
+    {
+        offsets[v + 1] += offsets[v];
+    }
+
+    targets.resize(offsets[n]);
+    weights.resize(offsets[n]);
+    for_each_range(pool, edge_sources.size(), [&](int thread_index, size_t begin, size_t end)
+    {
+        std::vector<int> &next = counts[thread_index];
+        for (size_t e = begin; e < end; e++)
+        {
+            int u = edge_sources[e];
+            int v = edge_targets[e];
+
+            int slot = offsets[u] + next[u]++;
+            targets[slot] = v;
+            weights[slot] = edge_weights[e];
+
+            slot = offsets[v] + next[v]++;
+            targets[slot] = u;
+            weights[slot] = edge_weights[e];
+        }
+    });
+}
+
+/**
+ * Builds an immutable CSR snapshot of the collected vertices and edges. Its label table is frozen.
+ *
+ * @param pool The threads to sort the edges on.
+ * @return The snapshot, equal to freezing a Graph that received the same vertices and edges in order.
+ */
+CsrGraph GraphBuilder::build_csr(ThreadPool &pool) const
+{
+    CsrGraph csr;
+    csr.number_of_verts = number_of_verts;
+    csr.vertex_labels = vertex_labels;
+    csr.vertex_labels.freeze();
+
+    std::vector<int> offsets;
+    std::vector<int> targets;
+    std::vector<int> weights;
+    _sort_edges(pool, offsets, targets, weights);
+    csr.offsets = std::move(offsets);
+    csr.targets = std::move(targets);
+    csr.weights = std::move(weights);
+    return csr;
+}
+
+/**
+ * Builds a Graph of the collected vertices and edges. Every adjacency vector is allocated once at its
+ * final size.
+ *
+ * @param pool The threads to sort the edges on and fill the adjacency lists with.
+ * @return The graph, equal to one that received the same vertices and edges through add_vertex and add_edge.
+ */
+Graph GraphBuilder::build(ThreadPool &pool) const
+{
+    std::vector<int> offsets;
+    std::vector<int> targets;
+    std::vector<int> weights;
+    _sort_edges(pool, offsets, targets, weights);
+
+    Graph graph;
+    graph.number_of_verts = number_of_verts;
+    graph.vertex_labels = vertex_labels;
+    graph.adj_list.resize(number_of_verts);
+    for_each_range(pool, number_of_verts, [&](int, size_t begin, size_t end)
+    {
+        for (size_t v = begin; v < end; v++)
+        {
+            std::vector<std::pair<int, int>> &edges = graph.adj_list[v];
+            edges.reserve(offsets[v + 1] - offsets[v]);
+            for (int e = offsets[v]; e < offsets[v + 1]; e++)
+            {
+                edges.emplace_back(targets[e], weights[e]);
+            }
+        }
+    });
+    return graph;
+}
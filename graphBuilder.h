@@ -0,0 +1,76 @@
+#ifndef GRAPHLIB_GRAPHBUILDER_H
+#define GRAPHLIB_GRAPHBUILDER_H
+
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+#include "csrGraph.h"
+#include "graph.h"
+#include "labelTable.h"
+#include "threadPool.h"
+
+// Bulk loader that collects edges in batches and lays them out in one pass, instead of growing one
+// adjacency vector per add_edge call.
+//
+// Edges are kept as three flat arrays until build time. Label batches intern their endpoints in
+// parallel: every thread owns the labels whose hash falls into its shard, and new labels receive ids
+// in the order they first appear, exactly as if add_vertex had been called for each endpoint in turn.
+// build_csr() then counting-sorts the edges by endpoint with one histogram per thread, so the result
+// lists every vertex's neighbors in insertion order, the same as a Graph filled edge by edge.
+class GraphBuilder {
+
+    int number_of_verts;                // Total number of vertices added so far.
+    LabelTable vertex_labels;           // Mapping between vertex labels and their indices.
+    std::vector<int> edge_sources;      // First endpoint of each edge, in insertion order.
+    std::vector<int> edge_targets;      // Second endpoint of each edge, parallel to edge_sources.
+    std::vector<int> edge_weights;      // Weight of each edge, parallel to edge_sources.
+
+    friend class ConcurrentIngestor;
+
+    // Resolve one chunk of label endpoints to vertex indices, interning new labels.
+    void _intern_chunk(const std::vector<std::string_view> &labels, std::vector<int> &indices, ThreadPool &pool);
+
+    // Counting-sort the edges into CSR offsets, targets and weights, both directions per edge.
+    void _sort_edges(ThreadPool &pool, std::vector<int> &offsets, std::vector<int> &targets, std::vector<int> &weights) const;
+
+public:
+
+    // Default constructor to initialize an empty builder.
+    GraphBuilder();
+
+    // Get the total number of vertices added so far.
+    int num_verts() const;
+
+    // Get the index of a vertex label, or -1 if it was not added.
+    int id_of(std::string_view label) const;
+
+    // Reserve room for a number of edges ahead of the batches that will add them.
+    void reserve_edges(size_t count);
+
+    // Add a new vertex with the specified label and return its index (its existing index if the label is taken).
+    int add_vertex(std::string_view label);
+
+    // Add count vertices labelled with their own indices ("0", "1", ...) and return the first new index.
+    // Throws std::invalid_argument if one of those labels already names another vertex.
+    int add_vertices(int count);
+
+    // Add an edge between two vertex indices. Returns false if either index is out of range.
+    bool add_edge(int from, int to, int weight = 1);
+
+    // Add a batch of (from index, to index, weight) edges. Returns false, adding nothing, if any index is out of range.
+    bool add_edges(const std::vector<std::tuple<int, int, int> > &edges);
+
+    // Add a batch of (from label, to label, weight) edges, adding every label not seen before as a vertex.
+    void add_edges(const std::vector<std::tuple<std::string_view, std::string_view, int> > &edges, ThreadPool &pool);
+    void add_edges(const std::vector<std::tuple<std::string, std::string, int> > &edges, ThreadPool &pool);
+
+    // Lay the collected edges out as an immutable CSR snapshot.
+    CsrGraph build_csr(ThreadPool &pool) const;
+
+    // Lay the collected edges out as a Graph that can still be modified.
+    Graph build(ThreadPool &pool) const;
+
+};
+
+#endif //GRAPHLIB_GRAPHBUILDER_H
@@ -0,0 +1,480 @@
+#include "graphImport.h"
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string_view>
+#include <tuple>
+#include <vector>
+#include "mappedFile.h"
+
+namespace {
+
+// Number of bytes parsed per round, which bounds the memory held by parsed but not yet added edges.
+const size_t IMPORT_WINDOW_BYTES = 64 << 20;
+
+// Number of pieces per thread a window is cut into, so threads that finish early pick up more work.
+const int PIECES_PER_THREAD = 4;
+
+// Check for the whitespace that separates tokens within a line.
+bool is_blank(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+// Move p past any whitespace before the end of the line.
+void skip_blanks(const char *&p, const char *end)
+{
+    while (p < end && is_blank(*p))
+    {
+        p++;
+    }
+}
+
+// Check whether only whitespace is left on the line.
+bool at_line_end(const char *p, const char *end)
+{
+    skip_blanks(p, end);
+    return p == end;
+}
+
+// Read the next whitespace-separated token of a line, or an empty view at the end of the line.
+std::string_view parse_token(const char *&p, const char *end)
+{
+    skip_blanks(p, end);
+    const char *start = p;
+    while (p < end && !is_blank(*p))
+    {
+        p++;
+    }
+    return std::string_view(start, p - start);
+}
+
+// Read the next token of a line as a decimal int. Fails on a missing token, trailing characters or overflow.
+bool parse_int(const char *&p, const char *end, int &value)
+{
+    skip_blanks(p, end);
+    bool negative = p < end && *p == '-';
+    if (p < end && (*p == '-' || *p == '+'))
+    {
+        p++;
+    }
+
+    const char *digits = p;
+    int64_t result = 0;
+    while (p < end && *p >= '0' && *p <= '9')
+    {
+        result = result * 10 + (*p - '0');
+        if (result > std::numeric_limits<int>::max())
+        {
+            return false;
+        }
+        p++;
+    }
+    if (p == digits || (p < end && !is_blank(*p)))
+    {
+        return false;
+    }
+
+    value = static_cast<int>(negative ? -result : result);
+    return true;
+}
+
+// Find the end of the line starting at p, excluding the newline.
+const char *line_end(const char *p, const char *end)
+{
+    const char *newline = static_cast<const char *>(std::memchr(p, '\n', end - p));
+    return newline != nullptr ? newline : end;
+}
+
+// Find the first line start at or after p, where begin is a line start at or before p.
+const char *next_line_start(const char *begin, const char *p, const char *end)
+{
+    if (p <= begin || p >= end || p[-1] == '\n')
+    {
+        return std::min(std::max(p, begin), end);
+    }
+    const char *newline = line_end(p, end);
+    return newline == end ? end : newline + 1;
+}
+
+// Call body(line_begin, line_end) for every line in [begin, end), which must start at a line start.
+template <typename F>
+bool for_each_line(const char *begin, const char *end, F body)
+{
+    while (begin < end)
+    {
+        const char *stop = line_end(begin, end);
+        if (!body(begin, stop))
+        {
+            return false;
+        }
+        begin = stop == end ? end : stop + 1;
+    }
+    return true;
+}
+
+// Walk [begin, end) in windows. Each window is cut at line starts into pieces; parse(piece, begin, end)
+// runs on the pieces in parallel, then commit(piece) runs on them in order on the calling thread.
+template <typename Parse, typename Commit>
+bool for_each_window(const char *begin, const char *end, ThreadPool &pool, Parse parse, Commit commit)
+{
+    int num_pieces = pool.num_threads() * PIECES_PER_THREAD;
+    std::vector<const char *> cuts(num_pieces + 1);
+    std::vector<char> parsed(num_pieces);
+
+    while (begin < end)
+    {
+        size_t window_bytes = std::min<size_t>(IMPORT_WINDOW_BYTES, end - begin);
+        const char *window_end = next_line_start(begin, begin + window_bytes, end);
+
+        cuts[0] = begin;
+        for (int i = 1; i < num_pieces; i++)
+        {
+            cuts[i] = next_line_start(cuts[i - 1], begin + (window_end - begin) * i / num_pieces, window_end);
+        }
+        cuts[num_pieces] = window_end;
+
+        pool.parallel_for(0, num_pieces, [&](int, int piece)
+        {
+            parsed[piece] = parse(piece, cuts[piece], cuts[piece + 1]);
+        }, 1);
+
+        for (int piece = 0; piece < num_pieces; piece++)
+        {
+            if (!parsed[piece] || !commit(piece))
+            {
+                return false;
+            }
+        }
+        begin = window_end;
+    }
+    return true;
+}
+
+// Add n vertices labelled "1" .. "n" after the existing ones and return the index of the first,
+// or -1 if n is negative or one of the labels is taken.
+int add_numbered_vertices(GraphBuilder &builder, int n)
+{
+    char buffer[16];
+    auto label = [&](int id)
+    {
+        char *stop = std::to_chars(buffer, buffer + sizeof(buffer), id).ptr;
+        return std::string_view(buffer, stop - buffer);
+    };
+
+    if (n < 0)
+    {
+        return -1;
+    }
+    for (int id = 1; id <= n; id++)
+    {
+        if (builder.id_of(label(id)) != -1)
+        {
+            return -1;
+        }
+    }
+
+    int first = builder.num_verts();
+    for (int id = 1; id <= n; id++)
+    {
+        builder.add_vertex(label(id));
+    }
+    return first;
+}
+
+// Reserve room for a number of edges announced in a file header, capped by what the file could hold.
+void reserve_announced_edges(GraphBuilder &builder, int announced, size_t file_bytes)
+{
+    if (announced > 0)
+    {
+        builder.reserve_edges(std::min<size_t>(announced, file_bytes / 4));
+    }
+}
+
+} // namespace
+
+
+namespace graph_import {
+
+/**
+ * Reads an edge list file into a builder. Each line holds a from label, a to label and an optional
+ * weight separated by spaces or tabs.
+ *
+ * @param path    The file to read.
+ * @param builder The builder to add the vertices and edges to.
+ * @param pool    The threads to parse on.
+ * @return True if the whole file was read, false if it cannot be mapped or a line is malformed.
+ */
+bool read_edge_list(const std::string &path, GraphBuilder &builder, ThreadPool &pool)
+{
+    MappedFile file;
+    if (!file.open(path))
+    {
+        return false;
+    }
+
+    std::vector<std::vector<std::tuple<std::string_view, std::string_view, int>>> pieces(pool.num_threads() * PIECES_PER_THREAD);
+    auto parse = [&](int piece, const char *begin, const char *end)
+    {
+        pieces[piece].clear();
+        return for_each_line(begin, end, [&](const char *p, const char *stop)
+        {
+            skip_blanks(p, stop);
+            if (p == stop || *p == '#' || *p == '%')
+            {
+                return true;
+            }
+
+            std::string_view from = parse_token(p, stop);
+            std::string_view to = parse_token(p, stop);
+            int weight = 1;
+            if (to.empty() || (!at_line_end(p, stop) && (!parse_int(p, stop, weight) || !at_line_end(p, stop))))
+            {
+                return false;
+            }
+            pieces[piece].emplace_back(from, to, weight);
+            return true;
+        });
+    };
+    auto commit = [&](int piece)
+    {
+        builder.add_edges(pieces[piece], pool);
+        return true;
+    };
+    return for_each_window(file.data(), file.data() + file.size(), pool, parse, commit);
+}
+
+/**
+ * Reads a DIMACS shortest-path file into a builder. Comment lines start with 'c', the problem line
+ * "p sp n m" must come before the first arc, and every arc line is "a from to weight" with 1-based ids.
+ *
+ * @param path      The file to read.
+ * @param builder   The builder to add the vertices and edges to.
+ * @param pool      The threads to parse on.
+ * @param symmetric Whether every arc is listed in both directions, so only arcs with from < to are added.
+ * @return True if the whole file was read, false if it cannot be mapped, a line is malformed, an arc
+ *         names a vertex outside 1 .. n, or the labels "1" .. "n" already name vertices of the builder.
+ */
+bool read_dimacs(const std::string &path, GraphBuilder &builder, ThreadPool &pool, bool symmetric)
+{
+    MappedFile file;
+    if (!file.open(path))
+    {
+        return false;
+    }
+
+    // The problem line is read on its own, since it sizes the vertex range the arcs are checked against.
+    const char *begin = file.data();
+    const char *end = file.data() + file.size();
+    int n = -1;
+    int m = 0;
+    while (begin < end && n == -1)
+    {
+        const char *p = begin;
+        const char *stop = line_end(begin, end);
+        begin = stop == end ? end : stop + 1;
+
+        skip_blanks(p, stop);
+        if (p == stop || *p == 'c')
+        {
+            continue;
+        }
+        if (parse_token(p, stop) != "p" || parse_token(p, stop).empty() || !parse_int(p, stop, n)
+            || !parse_int(p, stop, m) || !at_line_end(p, stop) || n < 0)
+        {
+            return false;
+        }
+    }
+
+    int first = add_numbered_vertices(builder, n);
+    if (first == -1)
+    {
+        return false;
+    }
+    reserve_announced_edges(builder, symmetric ? m / 2 : m, file.size());
+
+    std::vector<std::vector<std::tuple<int, int, int>>> pieces(pool.num_threads() * PIECES_PER_THREAD);
+    auto parse = [&](int piece, const char *piece_begin, const char *piece_end)
+    {
+        pieces[piece].clear();
+        return for_each_line(piece_begin, piece_end, [&](const char *p, const char *stop)
+        {
+            skip_blanks(p, stop);
+            if (p == stop || *p == 'c')
+            {
+                return true;
+            }
+
+            int from;
+            int to;
+            int weight;
+            if (parse_token(p, stop) != "a" || !parse_int(p, stop, from) || !parse_int(p, stop, to)
+                || !parse_int(p, stop, weight) || !at_line_end(p, stop)
+                || from < 1 || from > n || to < 1 || to > n)
+            {
+                return false;
+            }
+            if (!symmetric || from < to)
+            {
+                pieces[piece].emplace_back(first + from - 1, first + to - 1, weight);
+            }
+            return true;
+        });
+    };
+    auto commit = [&](int piece)
+    {
+        return builder.add_edges(pieces[piece]);
+    };
+    return for_each_window(begin, end, pool, parse, commit);
+}
+
+/**
+ * Reads a METIS graph file into a builder. Comment lines start with '%'. The header is "n m [fmt [ncon]]",
+ * where the digits of fmt flag, from the right, edge weights, vertex weights and vertex sizes, and ncon
+ * is the number of weights per vertex. Line i of the body lists the neighbors of vertex i, each followed
+ * by its edge weight if fmt has edge weights. A blank line is a vertex without neighbors.
+ *
+ * @param path    The file to read.
+ * @param builder The builder to add the vertices and edges to.
+ * @param pool    The threads to parse on.
+ * @return True if the whole file was read, false if it cannot be mapped, a line is malformed, there are
+ *         more than n vertex lines, a neighbor lies outside 1 .. n, or the labels "1" .. "n" are taken.
+ */
+bool read_metis(const std::string &path, GraphBuilder &builder, ThreadPool &pool)
+{
+    MappedFile file;
+    if (!file.open(path))
+    {
+        return false;
+    }
+
+    const char *begin = file.data();
+    const char *end = file.data() + file.size();
+    int n = -1;
+    int m = 0;
+    bool edge_weights = false;
+    int skipped_per_vertex = 0;
+    while (begin < end && n == -1)
+    {
+        const char *p = begin;
+        const char *stop = line_end(begin, end);
+        begin = stop == end ? end : stop + 1;
+
+        skip_blanks(p, stop);
+        if (p == stop || *p == '%')
+        {
+            continue;
+        }
+        if (!parse_int(p, stop, n) || !parse_int(p, stop, m) || n < 0)
+        {
+            return false;
+        }
+
+        std::string_view fmt = parse_token(p, stop);
+        if (fmt.size() > 3 || fmt.find_first_not_of("01") != std::string_view::npos)
+        {
+            return false;
+        }
+        auto flag = [&](size_t digit)
+        {
+            return fmt.size() > digit && fmt[fmt.size() - 1 - digit] == '1';
+        };
+        int ncon = 1;
+        if (!at_line_end(p, stop) && (!parse_int(p, stop, ncon) || ncon < 1 || !at_line_end(p, stop)))
+        {
+            return false;
+        }
+        edge_weights = flag(0);
+        skipped_per_vertex = (flag(1) ? ncon : 0) + (flag(2) ? 1 : 0);
+    }
+
+    int first = add_numbered_vertices(builder, n);
+    if (first == -1)
+    {
+        return false;
+    }
+    reserve_announced_edges(builder, m, file.size());
+
+    // Each piece records its edges by the position of their vertex line within the piece; the commit
+    // step, which knows how many vertex lines came before the piece, turns them into vertex ids.
+    struct Piece {
+        std::vector<std::tuple<int, int, int>> edges;   // (line within the piece, neighbor id, weight).
+        int lines;                                      // Number of vertex lines in the piece.
+        int last_used_line;                             // Last non-blank vertex line, or -1.
+    };
+    std::vector<Piece> pieces(pool.num_threads() * PIECES_PER_THREAD);
+    auto parse = [&](int piece, const char *piece_begin, const char *piece_end)
+    {
+        Piece &state = pieces[piece];
+        state.edges.clear();
+        state.lines = 0;
+        state.last_used_line = -1;
+        return for_each_line(piece_begin, piece_end, [&](const char *p, const char *stop)
+        {
+            skip_blanks(p, stop);
+            if (p < stop && *p == '%')
+            {
+                return true;
+            }
+
+            int line = state.lines++;
+            if (!at_line_end(p, stop))
+            {
+                state.last_used_line = line;
+            }
+
+            int value;
+            for (int i = 0; i < skipped_per_vertex; i++)
+            {
+                if (!parse_int(p, stop, value))
+                {
+                    return false;
+                }
+            }
+            while (!at_line_end(p, stop))
+            {
+                int neighbor;
+                int weight = 1;
+                if (!parse_int(p, stop, neighbor) || (edge_weights && !parse_int(p, stop, weight)))
+                {
+                    return false;
+                }
+                state.edges.emplace_back(line, neighbor, weight);
+            }
+            return true;
+        });
+    };
+
+    int lines_before = 0;
+    std::vector<std::tuple<int, int, int>> edges;
+    auto commit = [&](int piece)
+    {
+        const Piece &state = pieces[piece];
+        if (state.last_used_line != -1 && lines_before + state.last_used_line >= n)
+        {
+            return false;
+        }
+
+        edges.clear();
+        for (const auto &edge : state.edges)
+        {
+            int from = lines_before + std::get<0>(edge) + 1;
+            int to = std::get<1>(edge);
+            if (to < 1 || to > n)
+            {
+                return false;
+            }
+            if (from < to)
+            {
+                edges.emplace_back(first + from - 1, first + to - 1, std::get<2>(edge));
+            }
+        }
+        lines_before += state.lines;
+        return builder.add_edges(edges);
+    };
+    return for_each_window(begin, end, pool, parse, commit);
+}
+
+} // namespace graph_import
@@ -0,0 +1,37 @@
+#ifndef GRAPHLIB_GRAPHIMPORT_H
+#define GRAPHLIB_GRAPHIMPORT_H
+
+#include <string>
+#include "graphBuilder.h"
+#include "threadPool.h"
+
+// Readers for common text graph formats that stream a file into a GraphBuilder.
+//
+// The file is mapped and processed in windows of a few tens of megabytes. Each window is cut at line
+// boundaries into pieces that the pool parses in parallel; tokens are read straight from the mapped
+// bytes with a hand-rolled integer parser, and labels are passed on as views into the mapping, so no
+// std::string is created per token. Pieces are handed to the builder in file order, which keeps vertex
+// numbering and neighbor order the same as reading the file line by line.
+//
+// Every reader returns false if the file cannot be mapped or a line is malformed. Edges read from
+// windows before the bad line stay in the builder.
+namespace graph_import {
+
+// Read a whitespace-separated "from to [weight]" edge list. Endpoints are vertex labels, the weight
+// defaults to 1, and blank lines or lines starting with '#' or '%' are skipped.
+bool read_edge_list(const std::string &path, GraphBuilder &builder, ThreadPool &pool);
+
+// Read a DIMACS shortest-path file ("p sp n m" followed by "a from to weight" arcs). The n vertices are
+// added after the builder's existing ones, labelled with their DIMACS ids "1" .. "n". With symmetric set,
+// the file is expected to list every road in both directions, as the DIMACS road networks do, and only
+// arcs with from < to are added; otherwise every arc becomes an edge.
+bool read_dimacs(const std::string &path, GraphBuilder &builder, ThreadPool &pool, bool symmetric = true);
+
+// Read a METIS graph file ("n m [fmt [ncon]]" followed by one adjacency line per vertex). The n vertices
+// are added after the builder's existing ones, labelled "1" .. "n". METIS lists every edge from both ends,
+// so each one is added once, from its lower-numbered end. Vertex sizes and weights are skipped.
+bool read_metis(const std::string &path, GraphBuilder &builder, ThreadPool &pool);
+
+} // namespace graph_import
+
+#endif //GRAPHLIB_GRAPHIMPORT_H
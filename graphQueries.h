@@ -0,0 +1,598 @@
+#ifndef GRAPHLIB_GRAPHQUERIES_H
+#define GRAPHLIB_GRAPHQUERIES_H
+
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include "graphAlgorithms.h"
+#include "labelTable.h"
+#include "neighborView.h"
+#include "parallelAlgorithms.h"
+#include "queryContext.h"
+#include "threadPool.h"
+
+// Query API shared by Graph and CsrGraph, written once over the algorithm cores in graphAlgorithms.h and
+// parallelAlgorithms.h. Each query resolves vertex labels, runs the algorithm on the derived graph and
+// turns indices back into labels.
+//
+// A graph type derives from GraphQueries<itself>, befriends it, and provides:
+//   int num_verts() const;
+//   template <typename F> void for_each_neighbor(int u, F f) const;
+//   LabelTable vertex_labels;                  // Labels of the vertex indices.
+//   bool _is_vertex(int idx) const;            // Whether idx names a vertex that queries may use.
+//   int _edge_weight(int from, int to) const;  // Weight of the first edge from -> to, or -1; both are vertices.
+//   NeighborView _neighbor_view(int u) const;  // Edges leaving vertex u.
+template <typename Derived>
+class GraphQueries {
+
+    const Derived &_self() const
+    {
+        return static_cast<const Derived &>(*this);
+    }
+
+protected:
+
+    /**
+     * Looks up the index of a vertex that must exist.
+     *
+     * @param label The label of the vertex.
+     * @return The index of the vertex.
+     * @throws std::out_of_range if no vertex has that label.
+     */
+    int _vertex_at(std::string_view label) const
+    {
+        int idx = id_of(label);
+        if (idx == -1)
+        {
+            throw std::out_of_range("Vertex label not found: " + std::string(label));
+        }
+        return idx;
+    }
+
+    /**
+     * Joins the labels of the vertices on a path.
+     *
+     * @param path The vertex indices of the path.
+     * @return The labels of the path separated by " - ".
+     */
+    std::string _path_string(const std::vector<int> &path) const
+    {
+        std::string path_string;
+        for (size_t i = 0; i < path.size(); i++)
+        {
+            path_string += label_of(path[i]);
+            if (i < path.size() - 1)
+            {
+                path_string += " - ";
+            }
+        }
+        return path_string;
+    }
+
+    /**
+     * Resolves the vertex an MST starts from.
+     *
+     * @param start_label The label of the start vertex.
+     * @param start       Receives the index of the start vertex.
+     * @return True if the vertex exists, false (after reporting the error) otherwise.
+     */
+    bool _find_start_vertex(std::string_view start_label, int &start) const
+    {
+        start = id_of(start_label);
+        if (start == -1)
+        {
+            std::cerr << "Start vertex label not found in the graph." << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * Translates MST edges from vertex indices to labels.
+     *
+     * @param edges The MST edges as (from index, to index, weight).
+     * @return The same edges as (from label, to label, weight).
+     */
+    std::vector<std::tuple<std::string, std::string, int> > _label_edges(const std::vector<std::tuple<int, int, int> > &edges) const
+    {
+        std::vector<std::tuple<std::string, std::string, int> > labelled;
+        for (const auto &edge : edges)
+        {
+            labelled.emplace_back(label_of(std::get<0>(edge)), label_of(std::get<1>(edge)), std::get<2>(edge));
+        }
+        return labelled;
+    }
+
+    /**
+     * Runs a point-to-point search between two labels and joins the path it leaves in the context.
+     *
+     * @param source  The label of the source vertex.
+     * @param target  The label of the target vertex.
+     * @param context The search buffers.
+     * @param search  Called as search(source index, target index) to fill context.path().
+     * @return The labels of the path, or just the target label if it was not reached.
+     */
+    template <typename Search>
+    std::string _label_path(std::string_view source, std::string_view target, QueryContext &context, Search search) const
+    {
+        int target_idx = _vertex_at(target);
+        search(_vertex_at(source), target_idx);
+
+        if (context.path().empty())
+        {
+            context.path().push_back(target_idx);
+        }
+        return _path_string(context.path());
+    }
+
+public:
+
+    /**
+     * Looks up the index of a vertex.
+     *
+     * @param label The label of the vertex.
+     * @return The index of the vertex, or -1 if no vertex has that label (or it was removed from a Graph).
+     */
+    int id_of(std::string_view label) const
+    {
+        int idx = _self().vertex_labels.id_of(label);
+        return _self()._is_vertex(idx) ? idx : -1;
+    }
+
+    /**
+     * Looks up the label of a vertex in constant time.
+     *
+     * @param id The index of the vertex, in [0, num_verts()).
+     * @return The label of the vertex.
+     */
+    std::string_view label_of(int id) const
+    {
+        return _self().vertex_labels.label_of(id);
+    }
+
+    /**
+     * Retrieves the weight of an edge between two vertices given by index.
+     *
+     * @param from The index of the source vertex.
+     * @param to   The index of the destination vertex.
+     * @return The weight of the first edge added between the vertices, or -1 if no such edge exists.
+     */
+    int edge_weight(int from, int to) const
+    {
+        if (!_self()._is_vertex(from) || !_self()._is_vertex(to))
+        {
+            return -1;
+        }
+        return _self()._edge_weight(from, to);
+    }
+
+    /**
+     * Retrieves the weight of an edge between two vertices.
+     *
+     * @param from The label of the source vertex.
+     * @param to   The label of the destination vertex.
+     * @return The weight of the edge between the specified vertices, or -1 if no such edge exists.
+     */
+    int edge_weight(std::string_view from, std::string_view to) const
+    {
+        return edge_weight(id_of(from), id_of(to));
+    }
+
+    /**
+     * Checks if an edge exists between two vertices given by index.
+     *
+     * @param from The index of the source vertex.
+     * @param to   The index of the destination vertex.
+     * @return True if an edge exists between the specified vertices, false otherwise.
+     */
+    bool has_edge(int from, int to) const
+    {
+        return edge_weight(from, to) != -1;
+    }
+
+    /**
+     * Checks if an edge exists between two vertices.
+     *
+     * @param from The label of the source vertex.
+     * @param to   The label of the destination vertex.
+     * @return True if an edge exists between the specified vertices, false otherwise.
+     */
+    bool has_edge(std::string_view from, std::string_view to) const
+    {
+        return has_edge(id_of(from), id_of(to));
+    }
+
+    /**
+     * Views the edges leaving a vertex in place, in the order for_each_neighbor visits them. The view is
+     * valid until the graph is next modified.
+     *
+     * @param u The index of the vertex.
+     * @return A view of the vertex's (neighbor, weight) edges, or an empty view if u is not a vertex.
+     */
+    NeighborView neighbors(int u) const
+    {
+        if (!_self()._is_vertex(u))
+        {
+            return NeighborView();
+        }
+        return _self()._neighbor_view(u);
+    }
+
+    /**
+     * Views the edges leaving a vertex in place.
+     *
+     * @param label The label of the vertex.
+     * @return A view of the vertex's (neighbor, weight) edges, or an empty view if the vertex is not found.
+     */
+    NeighborView neighbors(std::string_view label) const
+    {
+        return neighbors(id_of(label));
+    }
+
+    /**
+     * Retrieves a vector of connected vertices (neighbors) and their corresponding edge weights for a given vertex.
+     *
+     * @param label The label of the vertex for which connected vertices are to be retrieved.
+     * @return A vector of pairs representing connected vertices and their edge weights, or an empty vector if the vertex is not found.
+     */
+    std::vector<std::pair<int, int> > get_connected(std::string_view label) const
+    {
+        std::vector<std::pair<int, int> > connected;
+        for (Neighbor edge : neighbors(label))
+        {
+            connected.emplace_back(edge.id, edge.weight);
+        }
+        return connected;
+    }
+
+    /**
+     * Computes the shortest distances from a source vertex given by index to all other vertices.
+     *
+     * @tparam Heap          The priority queue policy, e.g. DaryHeap<4>.
+     * @param source         The index of the source vertex.
+     * @param previous_nodes A vector to store the previous node in the shortest path for each vertex.
+     * @return A vector of shortest distances from the source to all other vertices, or an empty vector if
+     *         source is not a vertex.
+     */
+    template <typename Heap = IndexedMinHeap>
+    std::vector<int> dijkstra_shortest_distances(int source, std::vector<int> &previous_nodes) const
+    {
+        if (!_self()._is_vertex(source))
+        {
+            return {};
+        }
+        return graph_algorithms::dijkstra<Heap>(_self(), source, previous_nodes);
+    }
+
+    /**
+     * Computes the shortest distances from a source vertex to all other vertices using Dijkstra's algorithm.
+     *
+     * @tparam Heap          The priority queue policy, e.g. DaryHeap<4>.
+     * @param source         The label of the source vertex.
+     * @param previous_nodes A vector to store the previous node in the shortest path for each vertex.
+     * @return A vector of shortest distances from the source to all other vertices.
+     */
+    template <typename Heap = IndexedMinHeap>
+    std::vector<int> dijkstra_shortest_distances(const std::string &source, std::vector<int> &previous_nodes) const
+    {
+        return dijkstra_shortest_distances<Heap>(_vertex_at(source), previous_nodes);
+    }
+
+    /**
+     * Computes the shortest distances from a source vertex given by index into a query context.
+     * Read the results with context.distance(v) and context.previous(v).
+     *
+     * @param source  The index of the source vertex.
+     * @param context The reusable search buffers that receive the distances and previous nodes.
+     * @return True if the search ran, false (leaving the context untouched) if source is not a vertex.
+     */
+    bool dijkstra_shortest_distances(int source, QueryContext &context) const
+    {
+        if (!_self()._is_vertex(source))
+        {
+            return false;
+        }
+        graph_algorithms::dijkstra(_self(), source, context);
+        return true;
+    }
+
+    /**
+     * Computes the shortest distances from a source vertex into a query context.
+     *
+     * @param source  The label of the source vertex.
+     * @param context The reusable search buffers that receive the distances and previous nodes.
+     * @throws std::out_of_range if no vertex has the source label.
+     */
+    void dijkstra_shortest_distances(const std::string &source, QueryContext &context) const
+    {
+        dijkstra_shortest_distances(_vertex_at(source), context);
+    }
+
+    /**
+     * Computes the same distances and previous nodes as dijkstra_shortest_distances with parallel
+     * delta-stepping. Where several shortest paths tie, the previous node chosen may differ.
+     *
+     * @param source         The label of the source vertex.
+     * @param previous_nodes A vector to store the previous node in the shortest path for each vertex.
+     * @param pool           The threads to run on.
+     * @param delta          The bucket width; <= 0 picks the average edge weight.
+     * @return A vector of shortest distances from the source to all other vertices.
+     */
+    std::vector<int> delta_stepping_shortest_distances(const std::string &source, std::vector<int> &previous_nodes, ThreadPool &pool, int delta = 0) const
+    {
+        return graph_algorithms::delta_stepping(_self(), _vertex_at(source), previous_nodes, pool, delta);
+    }
+
+    /**
+     * Computes the distance from every source vertex to every target vertex, running the sources in parallel.
+     *
+     * @param sources The labels of the source vertices (matrix rows).
+     * @param targets The labels of the target vertices (matrix columns).
+     * @param pool    The threads to run on.
+     * @return The row-major distance matrix.
+     */
+    DistanceMatrix distance_matrix(const std::vector<std::string> &sources, const std::vector<std::string> &targets, ThreadPool &pool) const
+    {
+        std::vector<int> source_indices;
+        std::vector<int> target_indices;
+        for (const auto &label : sources)
+        {
+            source_indices.push_back(_vertex_at(label));
+        }
+        for (const auto &label : targets)
+        {
+            target_indices.push_back(_vertex_at(label));
+        }
+        return graph_algorithms::distance_matrix(_self(), source_indices, target_indices, pool);
+    }
+
+    /**
+     * Computes the shortest path between two vertices with a bidirectional Dijkstra search, which meets in
+     * the middle instead of settling everything closer to the source than the target. The buffers of the
+     * query context are reused, so repeated queries do not allocate.
+     *
+     * @param source  The label of the source vertex.
+     * @param target  The label of the target vertex.
+     * @param context The reusable search buffers.
+     * @return A string representation of the shortest path from the source to the target vertex.
+     */
+    std::string shortest_path(const std::string &source, const std::string &target, QueryContext &context) const
+    {
+        return _label_path(source, target, context, [&](int s, int t)
+        {
+            graph_algorithms::bidirectional_dijkstra(_self(), s, t, context);
+        });
+    }
+
+    /**
+     * Computes the shortest path between two vertices with a throwaway query context.
+     *
+     * @param source The label of the source vertex.
+     * @param target The label of the target vertex.
+     * @return A string representation of the shortest path from the source to the target vertex.
+     */
+    std::string shortest_path(const std::string &source, const std::string &target) const
+    {
+        QueryContext context;
+        return shortest_path(source, target, context);
+    }
+
+    /**
+     * Computes the shortest path between two vertices, stopping the search as soon as the target is
+     * settled. The distance bound and hop limit in options can cut the search short even earlier.
+     *
+     * @param source  The label of the source vertex.
+     * @param target  The label of the target vertex.
+     * @param options The distance bound and hop limit of the search.
+     * @param context The reusable search buffers.
+     * @return A string representation of the shortest path, or just the target label if it was not reached.
+     */
+    std::string shortest_path(const std::string &source, const std::string &target, const ShortestPathOptions &options, QueryContext &context) const
+    {
+        return _label_path(source, target, context, [&](int s, int t)
+        {
+            graph_algorithms::dijkstra_to_target(_self(), s, t, context, options);
+        });
+    }
+
+    /**
+     * Computes the bounded shortest path between two vertices with a throwaway query context.
+     *
+     * @param source  The label of the source vertex.
+     * @param target  The label of the target vertex.
+     * @param options The distance bound and hop limit of the search.
+     * @return A string representation of the shortest path, or just the target label if it was not reached.
+     */
+    std::string shortest_path(const std::string &source, const std::string &target, const ShortestPathOptions &options) const
+    {
+        QueryContext context;
+        return shortest_path(source, target, options, context);
+    }
+
+    /**
+     * Computes the shortest path with A* search, guided by a heuristic such as CoordinateHeuristic or AltHeuristic.
+     *
+     * @param source    The label of the source vertex.
+     * @param target    The label of the target vertex.
+     * @param heuristic A lower bound on the remaining distance to the target.
+     * @param context   The reusable search buffers.
+     * @return A string representation of the shortest path, or just the target label if it was not reached.
+     */
+    template <typename Heuristic>
+    std::string shortest_path_astar(const std::string &source, const std::string &target, const Heuristic &heuristic, QueryContext &context) const
+    {
+        return _label_path(source, target, context, [&](int s, int t)
+        {
+            graph_algorithms::astar(_self(), s, t, heuristic, context);
+        });
+    }
+
+    /**
+     * Computes the shortest path with A* search and a throwaway query context.
+     *
+     * @param source    The label of the source vertex.
+     * @param target    The label of the target vertex.
+     * @param heuristic A lower bound on the remaining distance to the target.
+     * @return A string representation of the shortest path, or just the target label if it was not reached.
+     */
+    template <typename Heuristic>
+    std::string shortest_path_astar(const std::string &source, const std::string &target, const Heuristic &heuristic) const
+    {
+        QueryContext context;
+        return shortest_path_astar(source, target, heuristic, context);
+    }
+
+    /**
+     * Computes the length of the shortest path between two vertices given by index with a bidirectional
+     * Dijkstra search, reusing the buffers of a query context. The vertex indices of the path are left in
+     * context.path().
+     *
+     * @param source  The index of the source vertex.
+     * @param target  The index of the target vertex.
+     * @param context The reusable search buffers.
+     * @return The shortest distance, std::numeric_limits<int>::max() if the target is unreachable, or -1 (with
+     *         an empty path) if either index is not a vertex.
+     */
+    int shortest_distance(int source, int target, QueryContext &context) const
+    {
+        if (!_self()._is_vertex(source) || !_self()._is_vertex(target))
+        {
+            context.path().clear();
+            return -1;
+        }
+        return graph_algorithms::bidirectional_dijkstra(_self(), source, target, context);
+    }
+
+    /**
+     * Computes the length of the shortest path between two vertices given by index.
+     *
+     * @param source The index of the source vertex.
+     * @param target The index of the target vertex.
+     * @return The shortest distance, std::numeric_limits<int>::max() if the target is unreachable, or -1 if
+     *         either index is not a vertex.
+     */
+    int shortest_distance(int source, int target) const
+    {
+        QueryContext context;
+        return shortest_distance(source, target, context);
+    }
+
+    /**
+     * Computes the length of the shortest path between two vertices, reusing the buffers of a query context.
+     *
+     * @param source  The label of the source vertex.
+     * @param target  The label of the target vertex.
+     * @param context The reusable search buffers.
+     * @return The shortest distance, or std::numeric_limits<int>::max() if the target is unreachable.
+     */
+    int shortest_distance(const std::string &source, const std::string &target, QueryContext &context) const
+    {
+        return shortest_distance(_vertex_at(source), _vertex_at(target), context);
+    }
+
+    /**
+     * Computes the length of the shortest path between two vertices.
+     *
+     * @param source The label of the source vertex.
+     * @param target The label of the target vertex.
+     * @return The shortest distance, or std::numeric_limits<int>::max() if the target is unreachable.
+     */
+    int shortest_distance(const std::string &source, const std::string &target) const
+    {
+        QueryContext context;
+        return shortest_distance(source, target, context);
+    }
+
+    /**
+     * Calculates the Minimum Spanning Tree (MST) of the component of a start vertex using Prim's algorithm.
+     *
+     * @tparam Heap  The priority queue policy, e.g. PairingHeap.
+     * @param start The index of the vertex from which to start building the MST.
+     * @return A vector of (parent index, child index, weight) tuples, where the parent is the tree vertex the
+     *         edge was joined from, or an empty vector if start is not a vertex.
+     */
+    template <typename Heap = IndexedMinHeap>
+    std::vector<std::tuple<int, int, int> > minimum_spanning_tree(int start) const
+    {
+        if (!_self()._is_vertex(start))
+        {
+            return {};
+        }
+        return graph_algorithms::prim<Heap>(_self(), start);
+    }
+
+    /**
+     * Calculates the Minimum Spanning Tree (MST) of the graph using Prim's algorithm.
+     *
+     * @tparam Heap        The priority queue policy, e.g. PairingHeap.
+     * @param start_label The label of the vertex from which to start building the MST.
+     * @return A vector of tuples representing the edges in the MST. Each tuple contains:
+     *         - The label of the parent vertex, the tree vertex the edge was joined from.
+     *         - The label of the vertex the edge added to the tree.
+     *         - The weight of the edge.
+     */
+    template <typename Heap = IndexedMinHeap>
+    std::vector<std::tuple<std::string, std::string, int> > minimum_spanning_tree(const std::string &start_label) const
+    {
+        int start;
+        if (!_find_start_vertex(start_label, start))
+        {
+            return {};
+        }
+        return _label_edges(minimum_spanning_tree<Heap>(start));
+    }
+
+    /**
+     * Calculates a minimum spanning forest of the whole graph using Kruskal's algorithm with a union-find.
+     *
+     * @return A vector of (from index, to index, weight) tuples with from < to, in increasing weight order;
+     *         one tree per connected component.
+     */
+    std::vector<std::tuple<int, int, int> > kruskal_minimum_spanning_forest() const
+    {
+        return graph_algorithms::kruskal(_self());
+    }
+
+    /**
+     * Calculates a minimum spanning forest of the whole graph using Filter-Kruskal, which discards edges
+     * inside a tree before sorting them. The total weight is the same as kruskal_minimum_spanning_forest(),
+     * but where edges tie a different one may be chosen.
+     *
+     * @return A vector of (from index, to index, weight) tuples with from < to, in increasing weight order.
+     */
+    std::vector<std::tuple<int, int, int> > filter_kruskal_minimum_spanning_forest() const
+    {
+        return graph_algorithms::filter_kruskal(_self());
+    }
+
+    /**
+     * Calculates a minimum spanning forest of the whole graph with parallel Borůvka rounds. Ties between
+     * equal weights are broken like Kruskal's, so the forest is exactly kruskal_minimum_spanning_forest().
+     *
+     * @param pool The threads to run on.
+     * @return A vector of (from index, to index, weight) tuples with from < to, in increasing weight order.
+     */
+    std::vector<std::tuple<int, int, int> > boruvka_minimum_spanning_forest(ThreadPool &pool) const
+    {
+        return graph_algorithms::boruvka(_self(), pool);
+    }
+
+    /**
+     * Calculates a minimum spanning forest of the whole graph with Filter-Kruskal and roots every tree at the
+     * lowest vertex of its component.
+     *
+     * @return The forest edges as (parent index, child index, weight), each tree listed from its root outwards
+     *         and trees in order of component id, plus the component id and tree parent of every vertex.
+     */
+    SpanningForest minimum_spanning_forest() const
+    {
+        return graph_algorithms::minimum_spanning_forest(_self());
+    }
+
+};
+
+#endif //GRAPHLIB_GRAPHQUERIES_H
@@ -0,0 +1,135 @@
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <string>
+#include "graph.h"
+
+// Compares the priority-queue policies of Dijkstra and Prim on three graph shapes:
+// a road-like grid, a uniform random sparse graph and a power-law (preferential attachment) graph.
+// Usage: HeapBenchmark [scale], where scale multiplies the default graph sizes.
+
+static Graph make_grid(int side, std::mt19937 &rng)
+{
+    Graph graph;
+    for (int i = 0; i < side * side; i++)
+    {
+        graph.add_vertex(std::to_string(i));
+    }
+    std::uniform_int_distribution<int> weight(1, 100);
+    for (int r = 0; r < side; r++)
+    {
+        for (int c = 0; c < side; c++)
+        {
+            int u = r * side + c;
+            if (c + 1 < side)
+            {
+                graph.add_edge(std::to_string(u), std::to_string(u + 1), weight(rng));
+            }
+            if (r + 1 < side)
+            {
+                graph.add_edge(std::to_string(u), std::to_string(u + side), weight(rng));
+            }
+        }
+    }
+    return graph;
+}
+
+static Graph make_random(int verts, int edges, std::mt19937 &rng)
+{
+    Graph graph;
+    for (int i = 0; i < verts; i++)
+    {
+        graph.add_vertex(std::to_string(i));
+    }
+    std::uniform_int_distribution<int> vertex(0, verts - 1);
+    std::uniform_int_distribution<int> weight(1, 1000);
+    for (int i = 0; i < edges; i++)
+    {
+        graph.add_edge(std::to_string(vertex(rng)), std::to_string(vertex(rng)), weight(rng));
+    }
+    return graph;
+}
+
+static Graph make_power_law(int verts, int edges_per_vertex, std::mt19937 &rng)
+{
+    Graph graph;
+    std::vector<int> endpoints; // Every edge endpoint once, so sampling from it is degree-proportional.
+    std::uniform_int_distribution<int> weight(1, 1000);
+    for (int v = 0; v < verts; v++)
+    {
+        graph.add_vertex(std::to_string(v));
+        for (int k = 0; k < edges_per_vertex && v > 0; k++)
+        {
+            int u = endpoints.empty() ? 0 : endpoints[rng() % endpoints.size()];
+            graph.add_edge(std::to_string(v), std::to_string(u), weight(rng));
+            endpoints.push_back(u);
+            endpoints.push_back(v);
+        }
+    }
+    return graph;
+}
+
+template <typename Heap>
+static void run_dijkstra(const char *name, const CsrGraph &graph)
+{
+    std::vector<int> previous_nodes(graph.num_verts(), -1);
+    auto start = std::chrono::steady_clock::now();
+    std::vector<int> distances = graph.dijkstra_shortest_distances<Heap>("0", previous_nodes);
+    auto end = std::chrono::steady_clock::now();
+
+    long long checksum = 0;
+    for (int d : distances)
+    {
+        checksum += d;
+    }
+    std::cout << "  dijkstra " << name << ": "
+              << std::chrono::duration<double, std::milli>(end - start).count() << " ms (checksum " << checksum << ")" << std::endl;
+}
+
+template <typename Heap>
+static void run_prim(const char *name, const CsrGraph &graph)
+{
+    auto start = std::chrono::steady_clock::now();
+    auto mst = graph.minimum_spanning_tree<Heap>("0");
+    auto end = std::chrono::steady_clock::now();
+
+    long long total = 0;
+    for (const auto &edge : mst)
+    {
+        total += std::get<2>(edge);
+    }
+    std::cout << "  prim     " << name << ": "
+              << std::chrono::duration<double, std::milli>(end - start).count() << " ms (weight " << total << ")" << std::endl;
+}
+
+static void run_all(const char *shape, const Graph &graph)
+{
+    CsrGraph frozen = graph.freeze();
+    std::cout << shape << " (" << frozen.num_verts() << " vertices, " << frozen.num_edges() << " directed edges)" << std::endl;
+
+    run_dijkstra<IndexedMinHeap>("binary ", frozen);
+    run_dijkstra<DaryHeap<4>>("4-ary  ", frozen);
+    run_dijkstra<DaryHeap<8>>("8-ary  ", frozen);
+    run_dijkstra<RadixHeap>("radix  ", frozen);
+    run_dijkstra<PairingHeap>("pairing", frozen);
+
+    run_prim<IndexedMinHeap>("binary ", frozen);
+    run_prim<DaryHeap<4>>("4-ary  ", frozen);
+    run_prim<DaryHeap<8>>("8-ary  ", frozen);
+    run_prim<PairingHeap>("pairing", frozen);
+}
+
+int main(int argc, char **argv)
+{
+    double scale = argc > 1 ? std::stod(argv[1]) : 1.0;
+    std::mt19937 rng(42);
+
+    int side = static_cast<int>(300 * std::sqrt(scale));
+    int verts = static_cast<int>(100000 * scale);
+
+    run_all("grid", make_grid(side, rng));
+    run_all("random", make_random(verts, 4 * verts, rng));
+    run_all("power-law", make_power_law(verts, 4, rng));
+    return 0;
+}
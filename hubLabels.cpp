@@ -0,0 +1,389 @@
+#include "hubLabels.h"
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <queue>
+
+namespace {
+
+const char HUB_LABELS_MAGIC[4] = {'G', 'L', 'H', 'L'};
+const uint32_t HUB_LABELS_VERSION = 1;
+
+// Write a vector of ints as raw bytes.
+void write_ints(std::ofstream &out, const std::vector<int> &values)
+{
+    out.write(reinterpret_cast<const char *>(values.data()), static_cast<std::streamsize>(values.size() * sizeof(int)));
+}
+
+// Read count ints into a vector; the stream's fail state reports a short read.
+void read_ints(std::ifstream &in, std::vector<int> &values, size_t count)
+{
+    values.resize(count);
+    in.read(reinterpret_cast<char *>(values.data()), static_cast<std::streamsize>(count * sizeof(int)));
+}
+
+// Check the arrays read from a file: the offsets start at 0, never decrease and end at num_entries, every
+// label lists hubs in [0, num_verts) in strictly increasing order with non-negative distances, and every
+// hub is a vertex index.
+bool labels_are_valid(const std::vector<int> &offsets, const std::vector<int> &hubs, const std::vector<int> &distances,
+                      const std::vector<int> &hub_vertices, int num_verts, int num_entries)
+{
+    if (offsets[0] != 0 || offsets[num_verts] != num_entries)
+    {
+        return false;
+    }
+    for (int v = 0; v < num_verts; v++)
+    {
+        if (offsets[v + 1] < offsets[v] || offsets[v + 1] > num_entries)
+        {
+            return false;
+        }
+        for (int i = offsets[v]; i < offsets[v + 1]; i++)
+        {
+            if (hubs[i] < 0 || hubs[i] >= num_verts || distances[i] < 0 || (i > offsets[v] && hubs[i] <= hubs[i - 1]))
+            {
+                return false;
+            }
+        }
+    }
+    for (int vertex : hub_vertices)
+    {
+        if (vertex < 0 || vertex >= num_verts)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+// Constructor for an empty HubLabels index
+HubLabels::HubLabels() : number_of_verts(0), label_offsets(1, 0) {}
+
+/**
+ * Builds the labels of a graph, using vertices of higher degree as hubs first.
+ *
+ * @param graph The graph to index.
+ */
+HubLabels::HubLabels(const CsrGraph &graph)
+    : number_of_verts(graph.num_verts()), vertex_labels(graph.vertex_labels)
+{
+    hub_vertices.resize(number_of_verts);
+    for (int v = 0; v < number_of_verts; v++)
+    {
+        hub_vertices[v] = v;
+    }
+    std::stable_sort(hub_vertices.begin(), hub_vertices.end(), [&](int a, int b)
+    {
+        return graph.offsets[a + 1] - graph.offsets[a] > graph.offsets[b + 1] - graph.offsets[b];
+    });
+    _build(graph);
+}
+
+/**
+ * Builds the labels of a graph, using the vertices a contraction hierarchy contracted last as hubs first.
+ *
+ * @param graph     The graph to index.
+ * @param hierarchy A contraction hierarchy of the same graph.
+ */
+HubLabels::HubLabels(const CsrGraph &graph, const ContractionHierarchy &hierarchy)
+    : number_of_verts(graph.num_verts()), vertex_labels(graph.vertex_labels)
+{
+    hub_vertices.resize(number_of_verts);
+    for (int v = 0; v < number_of_verts; v++)
+    {
+        hub_vertices[number_of_verts - 1 - hierarchy.rank(v)] = v;
+    }
+    _build(graph);
+}
+
+/**
+ * Builds the labels with pruned landmark labeling. Vertices become hubs in hub_vertices order, and
+ * each runs a Dijkstra search that adds itself to the label of every vertex it settles, except where
+ * the labels built so far already give a distance at least as short. Those vertices are pruned and
+ * not expanded, so later searches stay small and labels stay short.
+ *
+ * @param graph The graph to index.
+ */
+void HubLabels::_build(const CsrGraph &graph)
+{
+    const int max = std::numeric_limits<int>::max();
+    const int n = number_of_verts;
+
+    std::vector<std::vector<std::pair<int, int>>> labels(n);
+    std::vector<int> root_label(n, max); // Distance from the current root to each hub rank in its label.
+    std::vector<int> distances(n, max);
+    std::vector<int> touched;
+    std::priority_queue<std::pair<int, int>, std::vector<std::pair<int, int>>, std::greater<std::pair<int, int>>> queue;
+
+    for (int hub = 0; hub < n; hub++)
+    {
+        int root = hub_vertices[hub];
+        for (const auto &entry : labels[root])
+        {
+            root_label[entry.first] = entry.second;
+        }
+
+        distances[root] = 0;
+        touched.push_back(root);
+        queue.push({0, root});
+        while (!queue.empty())
+        {
+            auto [d, u] = queue.top();
+            queue.pop();
+            if (d > distances[u])
+            {
+                continue;
+            }
+
+            bool pruned = false;
+            for (const auto &entry : labels[u])
+            {
+                if (root_label[entry.first] != max && root_label[entry.first] + entry.second <= d)
+                {
+                    pruned = true;
+                    break;
+                }
+            }
+            if (pruned)
+            {
+                continue;
+            }
+
+            labels[u].emplace_back(hub, d);
+            graph.for_each_neighbor(u, [&](int v, int weight)
+            {
+                if (d + weight < distances[v])
+                {
+                    if (distances[v] == max)
+                    {
+                        touched.push_back(v);
+                    }
+                    distances[v] = d + weight;
+                    queue.push({distances[v], v});
+                }
+            });
+        }
+
+        for (int v : touched)
+        {
+            distances[v] = max;
+        }
+        touched.clear();
+        for (const auto &entry : labels[root])
+        {
+            root_label[entry.first] = max;
+        }
+    }
+
+    // Labels were filled in hub order, so each one is already sorted; pack them contiguously.
+    label_offsets.assign(n + 1, 0);
+    for (int v = 0; v < n; v++)
+    {
+        label_offsets[v + 1] = label_offsets[v] + static_cast<int>(labels[v].size());
+    }
+    label_hubs.reserve(label_offsets[n]);
+    label_distances.reserve(label_offsets[n]);
+    for (auto &label : labels)
+    {
+        for (const auto &entry : label)
+        {
+            label_hubs.push_back(entry.first);
+            label_distances.push_back(entry.second);
+        }
+        std::vector<std::pair<int, int>>().swap(label);
+    }
+}
+
+/**
+ * Returns the total number of vertices in the graph.
+ *
+ * @return The number of vertices in the graph.
+ */
+int HubLabels::num_verts() const
+{
+    return number_of_verts;
+}
+
+/**
+ * Returns the total size of the index.
+ *
+ * @return The number of (hub, distance) entries over all labels.
+ */
+int HubLabels::num_entries() const
+{
+    return label_offsets[number_of_verts];
+}
+
+/**
+ * Computes the shortest distance between two vertex indices by merging their sorted labels.
+ *
+ * @param source The index of the source vertex.
+ * @param target The index of the target vertex.
+ * @return The shortest distance, std::numeric_limits<int>::max() if the vertices share no hub, or -1 if
+ *         either index is out of range.
+ */
+int HubLabels::distance(int source, int target) const
+{
+    if (source < 0 || source >= number_of_verts || target < 0 || target >= number_of_verts)
+    {
+        return -1;
+    }
+
+    const int max = std::numeric_limits<int>::max();
+    int i = label_offsets[source];
+    int i_end = label_offsets[source + 1];
+    int j = label_offsets[target];
+    int j_end = label_offsets[target + 1];
+
+    int best = max;
+    while (i < i_end && j < j_end)
+    {
+        int hub_i = label_hubs[i];
+        int hub_j = label_hubs[j];
+        if (hub_i == hub_j)
+        {
+            int d = label_distances[i] + label_distances[j];
+            if (d < best)
+            {
+                best = d;
+            }
+            i++;
+            j++;
+        }
+        else if (hub_i < hub_j)
+        {
+            i++;
+        }
+        else
+        {
+            j++;
+        }
+    }
+    return best;
+}
+
+/**
+ * Computes the shortest distance between two vertices.
+ *
+ * @param source The label of the source vertex.
+ * @param target The label of the target vertex.
+ * @return The shortest distance, or std::numeric_limits<int>::max() if target is unreachable.
+ */
+int HubLabels::shortest_distance(const std::string &source, const std::string &target) const
+{
+    return distance(vertex_labels.at(source), vertex_labels.at(target));
+}
+
+/**
+ * Writes the index to a binary file: a magic tag and version, the vertex and entry counts, the
+ * length-prefixed vertex labels, then the offset, hub, distance and hub-vertex arrays. Integers are
+ * stored in host byte order.
+ *
+ * @param path The file to write.
+ * @return True if the whole index was written, false otherwise.
+ */
+bool HubLabels::save(const std::string &path) const
+{
+    std::ofstream out(path, std::ios::binary);
+    if (!out)
+    {
+        return false;
+    }
+
+    int32_t counts[2] = {number_of_verts, num_entries()};
+    out.write(HUB_LABELS_MAGIC, sizeof(HUB_LABELS_MAGIC));
+    out.write(reinterpret_cast<const char *>(&HUB_LABELS_VERSION), sizeof(HUB_LABELS_VERSION));
+    out.write(reinterpret_cast<const char *>(counts), sizeof(counts));
+
+    for (int v = 0; v < number_of_verts; v++)
+    {
+        std::string_view label = vertex_labels.label_of(v);
+        uint32_t length = label.size();
+        out.write(reinterpret_cast<const char *>(&length), sizeof(length));
+        out.write(label.data(), length);
+    }
+
+    write_ints(out, label_offsets);
+    write_ints(out, label_hubs);
+    write_ints(out, label_distances);
+    write_ints(out, hub_vertices);
+    return static_cast<bool>(out);
+}
+
+/**
+ * Reads an index written by save(). The counts in the header are checked against the file size before
+ * anything is allocated, and the arrays are checked before they are used, so a truncated or corrupt file
+ * is rejected instead of being read out of bounds. The current index is only replaced if the file is valid.
+ *
+ * @param path The file to read.
+ * @return True if the index was loaded, false if the file is missing, truncated, inconsistent or not a
+ *         hub label index.
+ */
+bool HubLabels::load(const std::string &path)
+{
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in)
+    {
+        return false;
+    }
+    const uint64_t file_bytes = static_cast<uint64_t>(in.tellg());
+    in.seekg(0);
+
+    char magic[4];
+    uint32_t version;
+    int32_t counts[2];
+    in.read(magic, sizeof(magic));
+    in.read(reinterpret_cast<char *>(&version), sizeof(version));
+    in.read(reinterpret_cast<char *>(counts), sizeof(counts));
+    if (!in || !std::equal(magic, magic + 4, HUB_LABELS_MAGIC) || version != HUB_LABELS_VERSION
+        || counts[0] < 0 || counts[1] < 0)
+    {
+        return false;
+    }
+
+    // Every byte the counts announce besides the label characters: one length per label and the four arrays.
+    const uint64_t n = static_cast<uint64_t>(counts[0]);
+    const uint64_t entries = static_cast<uint64_t>(counts[1]);
+    const uint64_t fixed_bytes = (n + (n + 1) + 2 * entries + n) * sizeof(int32_t);
+    const uint64_t header_bytes = sizeof(magic) + sizeof(version) + sizeof(counts);
+    if (file_bytes < header_bytes + fixed_bytes)
+    {
+        return false;
+    }
+    uint64_t label_bytes = file_bytes - header_bytes - fixed_bytes;
+
+    HubLabels loaded;
+    loaded.number_of_verts = counts[0];
+    std::string label;
+    for (int v = 0; v < counts[0] && in; v++)
+    {
+        uint32_t length;
+        in.read(reinterpret_cast<char *>(&length), sizeof(length));
+        if (!in || length > label_bytes)
+        {
+            return false;
+        }
+        label_bytes -= length;
+        label.resize(length);
+        in.read(&label[0], length);
+        loaded.vertex_labels.intern(label);
+    }
+
+    read_ints(in, loaded.label_offsets, n + 1);
+    read_ints(in, loaded.label_hubs, entries);
+    read_ints(in, loaded.label_distances, entries);
+    read_ints(in, loaded.hub_vertices, n);
+    if (!in || loaded.vertex_labels.size() != counts[0]
+        || !labels_are_valid(loaded.label_offsets, loaded.label_hubs, loaded.label_distances, loaded.hub_vertices, counts[0], counts[1]))
+    {
+        return false;
+    }
+
+    loaded.vertex_labels.freeze();
+    *this = std::move(loaded);
+    return true;
+}
@@ -0,0 +1,60 @@
+#ifndef GRAPHLIB_HUBLABELS_H
+#define GRAPHLIB_HUBLABELS_H
+
+#include <string>
+#include <vector>
+#include "contractionHierarchy.h"
+#include "csrGraph.h"
+#include "labelTable.h"
+
+// Hub labeling distance oracle built with pruned landmark labeling.
+//
+// Every vertex v stores a label: a list of (hub, d(hub, v)) pairs sorted by hub, such that any two
+// vertices share a hub on one of their shortest paths. distance(u, v) is then the smallest
+// d(h, u) + d(h, v) over the hubs h common to both labels, found by merging two sorted arrays.
+// Queries never touch the graph, and the index can be saved to and loaded from disk.
+class HubLabels {
+
+    int number_of_verts;                        // Total number of vertices in the graph.
+    std::vector<int> label_offsets;             // Start of each vertex's label, number_of_verts + 1 entries.
+    std::vector<int> label_hubs;                // Hub of each label entry, as its rank in the hub order.
+    std::vector<int> label_distances;           // Distance to the hub, parallel to label_hubs.
+    std::vector<int> hub_vertices;              // Vertex index of each hub rank.
+    LabelTable vertex_labels;                   // Mapping between vertex labels and their indices.
+
+    // Build the labels, using the vertices in hub_vertices order as hubs.
+    void _build(const CsrGraph &graph);
+
+public:
+
+    // Default constructor to initialize an empty index, e.g. before load().
+    HubLabels();
+
+    // Build the labels of a frozen graph, choosing hubs by decreasing degree.
+    explicit HubLabels(const CsrGraph &graph);
+
+    // Build the labels of a frozen graph, choosing hubs by decreasing contraction rank. Much smaller
+    // labels than the degree order on road-like graphs, where most vertices have the same degree.
+    HubLabels(const CsrGraph &graph, const ContractionHierarchy &hierarchy);
+
+    // Get the total number of vertices in the graph.
+    int num_verts() const;
+
+    // Get the total number of (hub, distance) entries over all labels.
+    int num_entries() const;
+
+    // Compute the shortest distance between two vertex indices. Returns -1 if either is out of range.
+    int distance(int source, int target) const;
+
+    // Compute the shortest distance between two vertices.
+    int shortest_distance(const std::string &source, const std::string &target) const;
+
+    // Write the index to a binary file. Returns false if the file cannot be written.
+    bool save(const std::string &path) const;
+
+    // Replace the index with one read from a binary file. Returns false if the file is missing or invalid.
+    bool load(const std::string &path);
+
+};
+
+#endif //GRAPHLIB_HUBLABELS_H
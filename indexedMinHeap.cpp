@@ -0,0 +1,225 @@
+#include "indexedMinHeap.h"
+
+/**
+ * Constructor to create an empty heap able to hold every id in [0, capacity).
+ *
+ * @param capacity The number of distinct ids the heap can hold.
+ */
+IndexedMinHeap::IndexedMinHeap(int capacity) : positions(capacity, -1)
+{
+    heap.reserve(capacity);
+}
+
+/**
+ * Private function to swap two heap slots while keeping the position index up to date.
+ *
+ * @param a The first heap position.
+ * @param b The second heap position.
+ */
+void IndexedMinHeap::_swap(int a, int b)
+{
+    std::swap(heap[a], heap[b]);
+    positions[heap[a].second] = a;
+    positions[heap[b].second] = b;
+}
+
+/**
+ * Private function to restore the heap property by "bubbling up" the element at the given index.
+ *
+ * @param index The index of the element to be moved up.
+ */
+void IndexedMinHeap::_heapify_up(int index)
+{
+    while (index > 0)
+    {
+        int parent = (index - 1) / 2;
+        if (heap[index] < heap[parent])
+        {
+            _swap(index, parent);
+            index = parent;
+        }
+        else
+        {
+            break; // The element is in its correct position.
+        }
+    }
+}
+
+/**
+ * Private function to maintain the heap property by "bubbling down" the element at the given index.
+ *
+ * @param index The index of the element to be heapified.
+ */
+void IndexedMinHeap::_heapify_down(int index)
+{
+    int n = heap.size();
+    while (true)
+    {
+        int left_child_idx = 2 * index + 1;
+        int right_child_idx = 2 * index + 2;
+        int smallest = index;
+
+        if (left_child_idx < n && heap[left_child_idx] < heap[smallest])
+        {
+            smallest = left_child_idx;
+        }
+
+        if (right_child_idx < n && heap[right_child_idx] < heap[smallest])
+        {
+            smallest = right_child_idx;
+        }
+
+        if (smallest != index)
+        {
+            _swap(index, smallest);
+            index = smallest;
+        }
+        else
+        {
+            break; // The heap property is preserved.
+        }
+    }
+}
+
+/**
+ * Insert a new element into the heap while maintaining the heap property.
+ *
+ * @param element The (key, id) element to be inserted into the heap.
+ * @throws std::invalid_argument if the id is already in the heap.
+ */
+void IndexedMinHeap::insert(std::pair<int, int> element)
+{
+    if (contains(element.second))
+    {
+        throw std::invalid_argument("Id is already in the heap");
+    }
+    heap.push_back(element);
+    positions[element.second] = heap.size() - 1;
+    _heapify_up(heap.size() - 1);
+}
+
+/**
+ * Lower the key of an id that is already in the heap.
+ *
+ * @param id  The id whose key is lowered.
+ * @param key The new key, which must not be larger than the current one.
+ * @throws std::invalid_argument if the id is not in the heap or the key would increase.
+ */
+void IndexedMinHeap::decrease_key(int id, int key)
+{
+    if (!contains(id))
+    {
+        throw std::invalid_argument("Id is not in the heap");
+    }
+    int position = positions[id];
+    if (key > heap[position].first)
+    {
+        throw std::invalid_argument("New key is larger than the current key");
+    }
+    heap[position].first = key;
+    _heapify_up(position);
+}
+
+/**
+ * Insert the id with the given key, or lower its key if it is already in the heap.
+ * A key that is not smaller than the stored one leaves the heap untouched.
+ *
+ * @param id  The id to insert or update.
+ * @param key The candidate key.
+ */
+void IndexedMinHeap::insert_or_decrease(int id, int key)
+{
+    int position = positions[id];
+    if (position == -1)
+    {
+        insert({key, id});
+    }
+    else if (key < heap[position].first)
+    {
+        heap[position].first = key;
+        _heapify_up(position);
+    }
+}
+
+/**
+ * Check if the id is currently in the heap.
+ *
+ * @param id The id to look for.
+ * @return True if the id is in the heap, otherwise false.
+ */
+bool IndexedMinHeap::contains(int id) const
+{
+    return positions[id] != -1;
+}
+
+/**
+ * Get the minimum element from the heap (the root).
+ *
+ * @return The minimum element in the heap.
+ * @throws std::runtime_error if the heap is empty.
+ */
+std::pair<int, int> IndexedMinHeap::get_min() const
+{
+    if (heap.empty())
+    {
+        throw std::runtime_error("Heap is empty");
+    }
+    return heap[0];
+}
+
+/**
+ * Extract and remove the minimum element from the heap.
+ *
+ * @return The extracted minimum element.
+ * @throws std::runtime_error if the heap is empty.
+ */
+std::pair<int, int> IndexedMinHeap::extract_min()
+{
+    if (heap.empty())
+    {
+        throw std::runtime_error("Heap is empty");
+    }
+    std::pair<int, int> min_val = heap[0];
+    _swap(0, heap.size() - 1);
+    heap.pop_back();
+    positions[min_val.second] = -1;
+
+    if (!heap.empty())
+    {
+        _heapify_down(0);
+    }
+    return min_val;
+}
+
+/**
+ * Remove every element from the heap. Only the positions of ids still in the heap are reset,
+ * so clearing a nearly empty heap is cheap regardless of its capacity.
+ */
+void IndexedMinHeap::clear()
+{
+    for (const auto &element : heap)
+    {
+        positions[element.second] = -1;
+    }
+    heap.clear();
+}
+
+/**
+ * Check if the heap is empty.
+ *
+ * @return True if the heap is empty, otherwise false.
+ */
+bool IndexedMinHeap::is_empty() const
+{
+    return heap.empty();
+}
+
+/**
+ * Get the current size (number of elements) of the heap.
+ *
+ * @return The number of elements in the heap.
+ */
+int IndexedMinHeap::size() const
+{
+    return heap.size();
+}
@@ -0,0 +1,56 @@
+#ifndef INDEXEDMINHEAP_H
+#define INDEXEDMINHEAP_H
+
+#include <vector>
+#include <stdexcept>
+
+// Binary min-heap of (key, id) pairs that tracks where each id sits in the heap.
+// Every id in [0, capacity) can be present at most once, so the heap never holds more than
+// capacity elements and an id's key can be lowered in place with decrease_key.
+class IndexedMinHeap {
+private:
+    std::vector<std::pair<int, int>> heap;
+    std::vector<int> positions; // Heap position of each id, -1 if the id is not in the heap.
+
+    // Helper function to maintain the heap property by moving an element up the heap.
+    void _heapify_up(int index);
+
+    // Helper function to maintain the heap property by moving an element down the heap.
+    void _heapify_down(int index);
+
+    // Swaps two heap slots and keeps positions in sync.
+    void _swap(int a, int b);
+
+public:
+    // Constructor to create an empty heap for ids in [0, capacity).
+    explicit IndexedMinHeap(int capacity);
+
+    // Inserts a new (key, id) element; the id must not already be in the heap.
+    void insert(std::pair<int, int> element);
+
+    // Lowers the key of an id that is already in the heap.
+    void decrease_key(int id, int key);
+
+    // Inserts the id, or lowers its key if it is already in the heap with a larger one.
+    void insert_or_decrease(int id, int key);
+
+    // Checks if the id is currently in the heap.
+    bool contains(int id) const;
+
+    // Retrieves the minimum element (root) of the min-heap.
+    std::pair<int, int> get_min() const;
+
+    // Removes and returns the minimum element (root) from the min-heap.
+    std::pair<int, int> extract_min();
+
+    // Removes every element in O(size), keeping the capacity, so the heap can be reused.
+    void clear();
+
+    // Checks if the min-heap is empty.
+    bool is_empty() const;
+
+    // Returns the current size (number of elements) of the min-heap.
+    int size() const;
+};
+
+#endif // INDEXEDMINHEAP_H
@@ -0,0 +1,20 @@
+#ifndef GRAPHLIB_LABELSHARDS_H
+#define GRAPHLIB_LABELSHARDS_H
+
+#include <cstddef>
+#include <cstdint>
+
+// Internal helper shared by GraphBuilder and ConcurrentIngestor, which both split label interning into
+// shards by label hash.
+namespace label_shards {
+
+// Shard of a label hash, in [0, num_shards). Uses the high bits, since the shard tables index their slots
+// with the low ones.
+inline size_t shard_of(size_t hash, size_t num_shards)
+{
+    return static_cast<size_t>((static_cast<uint64_t>(hash) * 0x9e3779b97f4a7c15ULL) >> 40) % num_shards;
+}
+
+} // namespace label_shards
+
+#endif //GRAPHLIB_LABELSHARDS_H
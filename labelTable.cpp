@@ -0,0 +1,518 @@
+#include "labelTable.h"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace {
+
+// Number of slots the probing table starts with.
+const size_t INITIAL_SLOTS = 16;
+
+// Average number of labels per perfect hash bucket.
+const size_t LABELS_PER_BUCKET = 4;
+
+// Number of seeds tried for one bucket before the perfect hash build gives up.
+const uint32_t MAX_SEED_ATTEMPTS = 1u << 16;
+
+// Stored in place of the hash of a forgotten label. hash() never returns it.
+const size_t FORGOTTEN_HASH = ~static_cast<size_t>(0);
+
+} // namespace
+
+
+// Constructor for the LabelTable class
+LabelTable::LabelTable() : label_offsets(std::vector<size_t>(1, 0)), slots(std::vector<int>(INITIAL_SLOTS, -1)) {}
+
+/**
+ * Hashes a label. Callers that hash labels in parallel before interning them, or look the same label
+ * up in several tables, can pass the result to the hashed overloads of intern and id_of.
+ *
+ * The label is consumed eight bytes at a time and finished with _mix. Unlike std::hash, the result
+ * does not depend on the standard library, so the slots of a saved snapshot stay valid wherever
+ * the snapshot is opened.
+ *
+ * @param label The label to hash.
+ * @return The hash of the label.
+ */
+size_t LabelTable::hash(std::string_view label)
+{
+    uint64_t h = label.size();
+    const char *p = label.data();
+    size_t remaining = label.size();
+    while (remaining > 0)
+    {
+        uint64_t word = 0;
+        size_t n = std::min<size_t>(remaining, sizeof(word));
+        std::memcpy(&word, p, n);
+        h = (h ^ word) * 0xff51afd7ed558ccdULL;
+        h ^= h >> 32;
+        p += n;
+        remaining -= n;
+    }
+    size_t label_hash = _mix(static_cast<size_t>(h), 0);
+    return label_hash == FORGOTTEN_HASH ? label_hash - 1 : label_hash;
+}
+
+/**
+ * Private function scrambling a label hash with a seed (splitmix64 finalizer), so every seed
+ * sends the labels of a bucket to an unrelated set of slots.
+ *
+ * @param hash The hash of a label.
+ * @param seed The seed of the label's bucket.
+ * @return The scrambled hash.
+ */
+size_t LabelTable::_mix(size_t hash, uint32_t seed)
+{
+    uint64_t x = static_cast<uint64_t>(hash) + (static_cast<uint64_t>(seed) + 1) * 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return static_cast<size_t>(x ^ (x >> 31));
+}
+
+/**
+ * Private function comparing an interned label against a lookup key, checking the stored hash first.
+ *
+ * @param id    The id of the interned label.
+ * @param hash  The hash of the key.
+ * @param label The key.
+ * @return True if the id was interned for the key.
+ */
+bool LabelTable::_matches(int id, size_t hash, std::string_view label) const
+{
+    return label_hashes[id] == hash && label_of(id) == label;
+}
+
+/**
+ * Private function rebuilding the probing table from the stored hashes. Forgotten labels are left out.
+ *
+ * @param capacity The new number of slots, a power of two larger than size().
+ */
+void LabelTable::_rehash(size_t capacity)
+{
+    seeds = MappedArray<uint32_t>();
+    std::vector<int> &table = slots.vector();
+    table.assign(capacity, -1);
+
+    size_t mask = capacity - 1;
+    for (int id = 0; id < size(); id++)
+    {
+        if (label_hashes[id] == FORGOTTEN_HASH)
+        {
+            continue;
+        }
+        size_t slot = label_hashes[id] & mask;
+        while (table[slot] != -1)
+        {
+            slot = (slot + 1) & mask;
+        }
+        table[slot] = id;
+    }
+}
+
+/**
+ * Returns the number of labels in the table.
+ *
+ * @return The number of interned labels, which is also the next id to be handed out.
+ */
+int LabelTable::size() const
+{
+    return static_cast<int>(label_offsets.size()) - 1;
+}
+
+/**
+ * Looks up a label, appending it to the arena under the next free id if it is not in the table yet.
+ * The table doubles once it is half full.
+ *
+ * @param label The label to intern.
+ * @return The id of the label.
+ */
+int LabelTable::intern(std::string_view label)
+{
+    return intern(label, hash(label));
+}
+
+/**
+ * Interns a label whose hash has already been computed.
+ *
+ * @param label      The label to intern.
+ * @param label_hash The value of hash(label).
+ * @return The id of the label.
+ */
+int LabelTable::intern(std::string_view label, size_t label_hash)
+{
+    int existing = _find(label_hash, label);
+    if (existing != -1)
+    {
+        return existing;
+    }
+
+    // A frozen table has no room for new labels; go back to probing.
+    if (!seeds.empty() || 2 * (label_hashes.size() + 1) > slots.size())
+    {
+        size_t capacity = INITIAL_SLOTS;
+        while (capacity < 2 * (label_hashes.size() + 1))
+        {
+            capacity *= 2;
+        }
+        _rehash(capacity);
+    }
+
+    int id = size();
+    std::vector<char> &characters = arena.vector();
+    characters.insert(characters.end(), label.begin(), label.end());
+    label_offsets.vector().push_back(characters.size());
+    label_hashes.vector().push_back(label_hash);
+
+    std::vector<int> &table = slots.vector();
+    size_t mask = table.size() - 1;
+    size_t slot = label_hash & mask;
+    while (table[slot] != -1)
+    {
+        slot = (slot + 1) & mask;
+    }
+    table[slot] = id;
+    return id;
+}
+
+/**
+ * Appends the labels of another table as one block: the arena and hashes are copied and each label is
+ * entered in the probing table with its stored hash, so no label is hashed or compared. Tables that
+ * split one label set by hash (see ConcurrentIngestor) can be merged this way.
+ *
+ * @param other A table with none of this table's labels; its id i becomes id size() + i here.
+ */
+void LabelTable::append(const LabelTable &other)
+{
+    size_t total = label_hashes.size() + other.label_hashes.size();
+    if (!seeds.empty() || 2 * total > slots.size())
+    {
+        size_t capacity = INITIAL_SLOTS;
+        while (capacity < 2 * total)
+        {
+            capacity *= 2;
+        }
+        _rehash(capacity);
+    }
+
+    int first = size();
+    std::vector<char> &characters = arena.vector();
+    size_t base = characters.size();
+    characters.insert(characters.end(), other.arena.data(), other.arena.data() + other.arena.size());
+    std::vector<size_t> &offsets = label_offsets.vector();
+    for (int id = 0; id < other.size(); id++)
+    {
+        offsets.push_back(base + other.label_offsets[id + 1]);
+    }
+    std::vector<size_t> &hashes = label_hashes.vector();
+    hashes.insert(hashes.end(), other.label_hashes.data(), other.label_hashes.data() + other.label_hashes.size());
+
+    std::vector<int> &table = slots.vector();
+    size_t mask = table.size() - 1;
+    for (int id = first; id < size(); id++)
+    {
+        if (hashes[id] == FORGOTTEN_HASH)
+        {
+            continue;
+        }
+        size_t slot = hashes[id] & mask;
+        while (table[slot] != -1)
+        {
+            slot = (slot + 1) & mask;
+        }
+        table[slot] = id;
+    }
+}
+
+/**
+ * Private function looking up a label whose hash has already been computed.
+ *
+ * @param hash  The hash of the label.
+ * @param label The label to look up.
+ * @return The id of the label, or -1 if it is not in the table.
+ */
+int LabelTable::_find(size_t hash, std::string_view label) const
+{
+    if (!seeds.empty())
+    {
+        int id = slots[_mix(hash, seeds[hash % seeds.size()]) % slots.size()];
+        return id != -1 && _matches(id, hash, label) ? id : -1;
+    }
+
+    size_t mask = slots.size() - 1;
+    for (size_t slot = hash & mask; slots[slot] != -1; slot = (slot + 1) & mask)
+    {
+        if (_matches(slots[slot], hash, label))
+        {
+            return slots[slot];
+        }
+    }
+    return -1;
+}
+
+/**
+ * Looks up the id of a label.
+ *
+ * @param label The label to look up.
+ * @return The id of the label, or -1 if it is not in the table.
+ */
+int LabelTable::id_of(std::string_view label) const
+{
+    return _find(hash(label), label);
+}
+
+/**
+ * Looks up the id of a label whose hash has already been computed.
+ *
+ * @param label      The label to look up.
+ * @param label_hash The value of hash(label).
+ * @return The id of the label, or -1 if it is not in the table.
+ */
+int LabelTable::id_of(std::string_view label, size_t label_hash) const
+{
+    return _find(label_hash, label);
+}
+
+/**
+ * Looks up the id of a label that must be in the table.
+ *
+ * @param label The label to look up.
+ * @return The id of the label.
+ * @throws std::out_of_range if the label is not in the table.
+ */
+int LabelTable::at(std::string_view label) const
+{
+    int id = id_of(label);
+    if (id == -1)
+    {
+        throw std::out_of_range("Vertex label not found: " + std::string(label));
+    }
+    return id;
+}
+
+/**
+ * Returns the label of an id as a view into the arena.
+ *
+ * @param id The id to look up, in [0, size()).
+ * @return The label the id was interned for.
+ */
+std::string_view LabelTable::label_of(int id) const
+{
+    return std::string_view(arena.data() + label_offsets[id], label_offsets[id + 1] - label_offsets[id]);
+}
+
+/**
+ * Stops a label from resolving to its id. The label keeps its place in the arena, so label_of(id)
+ * and every other id are unchanged. Its stored hash is replaced by a marker that rehashing, perfect
+ * hash builds and snapshots keep, so the label stays forgotten through all of them. A frozen table
+ * just empties the label's slot, since every lookup reads exactly one slot; a probing table shifts the
+ * rest of the probe run back over the hole, so lookups of later labels still find them.
+ *
+ * @param id The id to forget, in [0, size()).
+ */
+void LabelTable::forget(int id)
+{
+    size_t label_hash = label_hashes[id];
+    if (label_hash == FORGOTTEN_HASH)
+    {
+        return;
+    }
+    label_hashes.vector()[id] = FORGOTTEN_HASH;
+
+    std::vector<int> &table = slots.vector();
+    if (!seeds.empty())
+    {
+        size_t slot = _mix(label_hash, seeds[label_hash % seeds.size()]) % table.size();
+        if (table[slot] == id)
+        {
+            table[slot] = -1;
+        }
+        return;
+    }
+
+    size_t mask = table.size() - 1;
+    size_t hole = label_hash & mask;
+    while (table[hole] != id)
+    {
+        if (table[hole] == -1)
+        {
+            return;
+        }
+        hole = (hole + 1) & mask;
+    }
+    table[hole] = -1;
+
+    for (size_t slot = (hole + 1) & mask; table[slot] != -1; slot = (slot + 1) & mask)
+    {
+        // The entry may fill the hole unless its probe sequence starts after the hole.
+        size_t home = label_hashes[table[slot]] & mask;
+        if (((slot - home) & mask) >= ((slot - hole) & mask))
+        {
+            table[hole] = table[slot];
+            table[slot] = -1;
+            hole = slot;
+        }
+    }
+}
+
+/**
+ * Checks whether forget() was called on an id that restore() has not brought back.
+ *
+ * @param id The id to check, in [0, size()).
+ * @return True if the id's label no longer resolves to it.
+ */
+bool LabelTable::is_forgotten(int id) const
+{
+    return label_hashes[id] == FORGOTTEN_HASH;
+}
+
+/**
+ * Makes a forgotten label resolve to its id again. Nothing changes if the id was not forgotten or its
+ * label has since been interned under another id. A frozen table puts the id back in its own slot if
+ * that slot is still free and otherwise goes back to probing.
+ *
+ * @param id The id to restore, in [0, size()).
+ */
+void LabelTable::restore(int id)
+{
+    std::string_view label = label_of(id);
+    size_t label_hash = hash(label);
+    if (label_hashes[id] != FORGOTTEN_HASH || _find(label_hash, label) != -1)
+    {
+        return;
+    }
+    label_hashes.vector()[id] = label_hash;
+
+    if (!seeds.empty())
+    {
+        size_t slot = _mix(label_hash, seeds[label_hash % seeds.size()]) % slots.size();
+        if (slots[slot] == -1)
+        {
+            slots.vector()[slot] = id;
+            return;
+        }
+    }
+    if (!seeds.empty() || 2 * label_hashes.size() > slots.size())
+    {
+        // Rebuilding the probing table enters every label that is not forgotten, this one included.
+        size_t capacity = INITIAL_SLOTS;
+        while (capacity < 2 * label_hashes.size())
+        {
+            capacity *= 2;
+        }
+        _rehash(capacity);
+        return;
+    }
+
+    std::vector<int> &table = slots.vector();
+    size_t mask = table.size() - 1;
+    size_t slot = label_hash & mask;
+    while (table[slot] != -1)
+    {
+        slot = (slot + 1) & mask;
+    }
+    table[slot] = id;
+}
+
+/**
+ * Private function laying out a hash-and-displace perfect hash. Labels are grouped into buckets by
+ * hash; buckets are placed largest first, each with the first seed that sends all its labels to
+ * distinct free slots.
+ *
+ * @param num_slots The number of slots, at least size().
+ * @return True if every bucket was placed, false if some bucket ran out of seeds.
+ */
+bool LabelTable::_build_perfect_hash(size_t num_slots)
+{
+    size_t num_buckets = label_hashes.size() / LABELS_PER_BUCKET + 1;
+
+    std::vector<std::vector<int>> buckets(num_buckets);
+    for (int id = 0; id < size(); id++)
+    {
+        if (label_hashes[id] != FORGOTTEN_HASH)
+        {
+            buckets[label_hashes[id] % num_buckets].push_back(id);
+        }
+    }
+    std::vector<size_t> order(num_buckets);
+    for (size_t b = 0; b < num_buckets; b++)
+    {
+        order[b] = b;
+    }
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b)
+    {
+        return buckets[a].size() > buckets[b].size();
+    });
+
+    std::vector<int> table(num_slots, -1);
+    std::vector<uint32_t> bucket_seeds(num_buckets, 0);
+    std::vector<size_t> placed;
+    for (size_t b : order)
+    {
+        const std::vector<int> &bucket = buckets[b];
+        if (bucket.empty())
+        {
+            break;
+        }
+
+        bool found = false;
+        for (uint32_t seed = 0; seed < MAX_SEED_ATTEMPTS && !found; seed++)
+        {
+            placed.clear();
+            found = true;
+            for (int id : bucket)
+            {
+                size_t slot = _mix(label_hashes[id], seed) % num_slots;
+                if (table[slot] != -1)
+                {
+                    found = false;
+                    break;
+                }
+                table[slot] = id;
+                placed.push_back(slot);
+            }
+            if (found)
+            {
+                bucket_seeds[b] = seed;
+            }
+            else
+            {
+                for (size_t slot : placed)
+                {
+                    table[slot] = -1;
+                }
+            }
+        }
+        if (!found)
+        {
+            return false;
+        }
+    }
+
+    slots = std::move(table);
+    seeds = std::move(bucket_seeds);
+    return true;
+}
+
+/**
+ * Replaces the probing table with a perfect hash over the current labels, using about 10% more
+ * slots than labels. If no perfect hash is found (for example when two labels share a full hash),
+ * the table keeps probing, so lookups stay correct either way.
+ */
+void LabelTable::freeze()
+{
+    if (label_hashes.empty() || !seeds.empty())
+    {
+        return;
+    }
+    _build_perfect_hash(label_hashes.size() + label_hashes.size() / 10 + 1);
+}
+
+/**
+ * Checks whether lookups currently go through the perfect hash.
+ *
+ * @return True if freeze() built a perfect hash and no label was interned since.
+ */
+bool LabelTable::is_frozen() const
+{
+    return !seeds.empty();
+}
@@ -0,0 +1,95 @@
+#ifndef GRAPHLIB_LABELTABLE_H
+#define GRAPHLIB_LABELTABLE_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "mappedFile.h"
+
+// Two-way mapping between vertex labels and the dense ids [0, size()) they were interned as.
+// The characters of every label are stored back to back in one arena string, so turning an id
+// into its label is a constant-time slice instead of a search through the label map.
+//
+// Labels are found through an open-addressing hash table of ids with linear probing. The hash of
+// every label is computed once and kept, so probes compare hashes before touching the arena and
+// growing the table never rehashes a string. freeze() swaps the probing table for a perfect hash,
+// which answers every lookup with exactly one slot and one comparison.
+//
+// All five arrays can also view a mapped snapshot file (see CsrGraph::open), in which case lookups
+// run on the mapped pages and the first new label copies them into memory.
+class LabelTable {
+
+    MappedArray<char> arena;                 // Characters of every label, in id order.
+    MappedArray<size_t> label_offsets;       // Start of each label in arena, size() + 1 entries.
+    MappedArray<size_t> label_hashes;        // Hash of each label, in id order.
+    MappedArray<int> slots;                  // Hash table of ids, -1 for an empty slot.
+    MappedArray<uint32_t> seeds;             // Perfect hash displacement of each bucket, empty unless frozen.
+
+    friend class CsrGraph;
+
+    // Scramble a hash with a perfect hash seed.
+    static size_t _mix(size_t hash, uint32_t seed);
+
+    // Check whether id holds the label with the given hash.
+    bool _matches(int id, size_t hash, std::string_view label) const;
+
+    // Find the id of a label whose hash is already known, or -1.
+    int _find(size_t hash, std::string_view label) const;
+
+    // Rebuild the probing table with the given power-of-two number of slots.
+    void _rehash(size_t capacity);
+
+    // Try to lay out a perfect hash over num_slots slots, returning false if no seeds were found.
+    bool _build_perfect_hash(size_t num_slots);
+
+public:
+
+    // Default constructor to initialize an empty table.
+    LabelTable();
+
+    // Get the number of interned labels.
+    int size() const;
+
+    // Hash a label the way the table does. The function is fixed, so hashes saved in a snapshot stay valid.
+    static size_t hash(std::string_view label);
+
+    // Get the id of a label, adding it with the next free id if it is new.
+    int intern(std::string_view label);
+    // Same as above, for a label whose hash(label) is already known.
+    int intern(std::string_view label, size_t label_hash);
+
+    // Add every label of another table under the next free ids, in its id order, reusing its stored hashes.
+    // None of its labels may be in this table yet.
+    void append(const LabelTable &other);
+
+    // Get the id of a label, or -1 if it was never interned.
+    int id_of(std::string_view label) const;
+    // Same as above, for a label whose hash(label) is already known.
+    int id_of(std::string_view label, size_t label_hash) const;
+
+    // Get the id of a label, throwing std::out_of_range if it was never interned.
+    int at(std::string_view label) const;
+
+    // Get the label of an id; the view stays valid until the next label is interned.
+    std::string_view label_of(int id) const;
+
+    // Make id_of stop finding the label of an id, without changing any id or label_of. Interning the
+    // label again gives it a new id.
+    void forget(int id);
+
+    // Check whether an id was forgotten and not restored since.
+    bool is_forgotten(int id) const;
+
+    // Make a forgotten label resolve to its id again, unless the label was interned under another id since.
+    void restore(int id);
+
+    // Build a perfect hash for the current labels; interning a new label falls back to probing.
+    void freeze();
+
+    // Check whether lookups currently use the perfect hash.
+    bool is_frozen() const;
+
+};
+
+#endif //GRAPHLIB_LABELTABLE_H
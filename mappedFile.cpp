@@ -0,0 +1,84 @@
+#include "mappedFile.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+// Constructor for an empty MappedFile
+MappedFile::MappedFile() : bytes(nullptr), length(0) {}
+
+// Destructor releasing the mapping
+MappedFile::~MappedFile()
+{
+    if (bytes != nullptr && length > 0)
+    {
+        munmap(const_cast<char *>(bytes), length);
+    }
+}
+
+/**
+ * Maps a file into memory read-only. The descriptor is closed right away; the mapping keeps the
+ * file contents reachable until the MappedFile is destroyed.
+ *
+ * @param path The file to map.
+ * @return True if the file was mapped (an empty file maps to no bytes), false if it is missing,
+ *         unreadable or cannot be mapped.
+ */
+bool MappedFile::open(const std::string &path)
+{
+    if (bytes != nullptr)
+    {
+        return false;
+    }
+
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0)
+    {
+        ::close(fd);
+        return false;
+    }
+    if (info.st_size == 0)
+    {
+        // An empty file cannot be mapped, but it is a valid file with no bytes.
+        ::close(fd);
+        return true;
+    }
+
+    void *address = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (address == MAP_FAILED)
+    {
+        return false;
+    }
+
+    bytes = static_cast<const char *>(address);
+    length = static_cast<size_t>(info.st_size);
+    return true;
+}
+
+/**
+ * Returns the start of the mapping.
+ *
+ * @return The first mapped byte, or nullptr if no file is mapped.
+ */
+const char *MappedFile::data() const
+{
+    return bytes;
+}
+
+/**
+ * Returns the size of the mapping.
+ *
+ * @return The number of mapped bytes.
+ */
+size_t MappedFile::size() const
+{
+    return length;
+}
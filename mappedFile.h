@@ -0,0 +1,103 @@
+#ifndef GRAPHLIB_MAPPEDFILE_H
+#define GRAPHLIB_MAPPEDFILE_H
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Read-only memory mapping of a whole file. Opening only reserves address space; the OS reads a
+// page from disk the first time it is touched, so the cost of open() does not grow with the file.
+class MappedFile {
+
+    const char *bytes;   // Start of the mapping, or nullptr if nothing is mapped.
+    size_t length;       // Number of mapped bytes.
+
+public:
+
+    // Default constructor to create an empty mapping.
+    MappedFile();
+
+    // Unmap the file.
+    ~MappedFile();
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    // Map a file read-only, returning false if it cannot be opened or mapped.
+    bool open(const std::string &path);
+
+    // Get the first mapped byte.
+    const char *data() const;
+
+    // Get the number of mapped bytes.
+    size_t size() const;
+
+};
+
+// Array that either owns its elements or views elements inside a MappedFile, which it keeps mapped
+// for as long as any copy of the array refers to it. Reading works the same either way; vector()
+// turns a view into an owned copy first, so a mapped array is only copied once it is modified.
+template <typename T>
+class MappedArray {
+
+    std::vector<T> owned;                       // Elements of an owned array.
+    std::shared_ptr<const MappedFile> mapping;  // File holding the elements of a view, or null.
+    const T *view;                              // First element of a view.
+    size_t count;                               // Number of elements of a view.
+
+public:
+
+    // Constructor to create an empty owned array.
+    MappedArray() : view(nullptr), count(0) {}
+
+    // Constructor to take over the elements of a vector.
+    MappedArray(std::vector<T> elements) : owned(std::move(elements)), view(nullptr), count(0) {}
+
+    // Constructor to view count elements starting at first, which must lie inside file.
+    MappedArray(std::shared_ptr<const MappedFile> file, const T *first, size_t count)
+        : mapping(std::move(file)), view(first), count(count) {}
+
+    // Get the number of elements.
+    size_t size() const
+    {
+        return mapping ? count : owned.size();
+    }
+
+    bool empty() const
+    {
+        return size() == 0;
+    }
+
+    // Get a pointer to the first element.
+    const T *data() const
+    {
+        return mapping ? view : owned.data();
+    }
+
+    const T &operator[](size_t i) const
+    {
+        return data()[i];
+    }
+
+    // Check whether the elements live in a mapped file.
+    bool is_mapped() const
+    {
+        return mapping != nullptr;
+    }
+
+    // Get the elements for modification, copying them out of the mapping first if needed.
+    std::vector<T> &vector()
+    {
+        if (mapping)
+        {
+            owned.assign(view, view + count);
+            mapping.reset();
+        }
+        return owned;
+    }
+
+};
+
+#endif //GRAPHLIB_MAPPEDFILE_H
@@ -0,0 +1,109 @@
+#ifndef GRAPHLIB_NEIGHBORVIEW_H
+#define GRAPHLIB_NEIGHBORVIEW_H
+
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+// One edge leaving a vertex, as seen through a NeighborView.
+struct Neighbor {
+    int id;       // Index of the neighbor.
+    int weight;   // Weight of the edge.
+};
+
+// Read-only view of the edges leaving one vertex, pointing straight into the graph's storage.
+//
+// A Graph keeps each neighbor list as (id, weight) pairs and a CsrGraph keeps ids and weights in two
+// parallel arrays. The view holds a pointer for either layout and reads each edge through the one that
+// is set, so it never walks an int pointer from one pair object into the next. It costs three pointers
+// and a count, and iterating it allocates nothing. It is valid until the graph it came from is next
+// modified (an edge or vertex is added, sort_adjacency() runs, or a snapshot is loaded) or destroyed.
+class NeighborView {
+
+    const std::pair<int, int> *pairs;   // Edges as (id, weight) pairs, or nullptr for parallel arrays.
+    const int *ids;                     // Ids of the edges when they are in parallel arrays.
+    const int *weights;                 // Weights of the edges, parallel to ids.
+    size_t count;                       // Number of edges.
+
+public:
+
+    // Iterator yielding the edges of the view as Neighbor values.
+    class iterator {
+
+        const std::pair<int, int> *pair;
+        const int *id;
+        const int *weight;
+
+    public:
+
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Neighbor;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = Neighbor;
+
+        iterator() : pair(nullptr), id(nullptr), weight(nullptr) {}
+        iterator(const std::pair<int, int> *pair, const int *id, const int *weight) : pair(pair), id(id), weight(weight) {}
+
+        Neighbor operator*() const { return pair ? Neighbor{pair->first, pair->second} : Neighbor{*id, *weight}; }
+        iterator &operator++()
+        {
+            if (pair)
+            {
+                ++pair;
+            }
+            else
+            {
+                ++id;
+                ++weight;
+            }
+            return *this;
+        }
+        iterator operator++(int) { iterator old = *this; ++*this; return old; }
+        bool operator==(const iterator &other) const { return pair == other.pair && id == other.id; }
+        bool operator!=(const iterator &other) const { return !(*this == other); }
+
+    };
+
+    // Constructor for an empty view.
+    NeighborView() : pairs(nullptr), ids(nullptr), weights(nullptr), count(0) {}
+
+    // Constructor for count edges whose ids and weights are in two parallel arrays.
+    NeighborView(const int *ids, const int *weights, size_t count)
+        : pairs(nullptr), ids(count ? ids : nullptr), weights(count ? weights : nullptr), count(count) {}
+
+    // Constructor for a neighbor list stored as (id, weight) pairs.
+    NeighborView(const std::pair<int, int> *edges, size_t count)
+        : pairs(count ? edges : nullptr), ids(nullptr), weights(nullptr), count(count) {}
+
+    iterator begin() const { return iterator(pairs, ids, weights); }
+    iterator end() const { return pairs ? iterator(pairs + count, nullptr, nullptr) : iterator(nullptr, ids + count, weights + count); }
+
+    // Get the number of edges (the degree of the vertex).
+    size_t size() const { return count; }
+
+    // Check whether the vertex has no edges.
+    bool empty() const { return count == 0; }
+
+    // Get the i-th edge, in the order the graph visits them.
+    Neighbor operator[](size_t i) const { return pairs ? Neighbor{pairs[i].first, pairs[i].second} : Neighbor{ids[i], weights[i]}; }
+
+    // Get the id of the i-th neighbor.
+    int id(size_t i) const { return pairs ? pairs[i].first : ids[i]; }
+
+    // Get the weight of the i-th edge.
+    int weight(size_t i) const { return pairs ? pairs[i].second : weights[i]; }
+
+    // Check whether ids and weights are contiguous arrays, as in a CsrGraph, so that id_data() and
+    // weight_data() can be handed to code expecting plain arrays of size() entries.
+    bool is_contiguous() const { return pairs == nullptr; }
+
+    // Get the ids as a plain array of size() entries, or nullptr if the view is not contiguous.
+    const int *id_data() const { return ids; }
+
+    // Get the weights as a plain array of size() entries, or nullptr if the view is not contiguous.
+    const int *weight_data() const { return weights; }
+
+};
+
+#endif //GRAPHLIB_NEIGHBORVIEW_H
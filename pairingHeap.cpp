@@ -0,0 +1,263 @@
+#include "pairingHeap.h"
+
+/**
+ * Constructor to create an empty heap able to hold every id in [0, capacity).
+ *
+ * @param capacity The number of distinct ids the heap can hold.
+ */
+PairingHeap::PairingHeap(int capacity)
+    : keys(capacity, 0), child(capacity, -1), sibling(capacity, -1), prev(capacity, -1),
+      in_heap(capacity, false), root(-1), count(0)
+{
+    // extract_min and clear never hold more than every node at once in the scratch list.
+    pairs.reserve(capacity);
+}
+
+/**
+ * Private function ordering two nodes by (key, id).
+ *
+ * @return True if node a should be extracted before node b.
+ */
+bool PairingHeap::_less(int a, int b) const
+{
+    return keys[a] < keys[b] || (keys[a] == keys[b] && a < b);
+}
+
+/**
+ * Private function making the larger of two detached roots the first child of the smaller.
+ *
+ * @param a The root of the first tree, or -1.
+ * @param b The root of the second tree, or -1.
+ * @return The root of the melded tree.
+ */
+int PairingHeap::_meld(int a, int b)
+{
+    if (a == -1)
+    {
+        return b;
+    }
+    if (b == -1)
+    {
+        return a;
+    }
+    if (_less(b, a))
+    {
+        std::swap(a, b);
+    }
+
+    sibling[b] = child[a];
+    if (child[a] != -1)
+    {
+        prev[child[a]] = b;
+    }
+    child[a] = b;
+    prev[b] = a;
+    return a;
+}
+
+/**
+ * Private function unlinking a non-root node from its parent or left sibling.
+ *
+ * @param id The node to detach.
+ */
+void PairingHeap::_cut(int id)
+{
+    int before = prev[id];
+    if (child[before] == id)
+    {
+        child[before] = sibling[id];
+    }
+    else
+    {
+        sibling[before] = sibling[id];
+    }
+    if (sibling[id] != -1)
+    {
+        prev[sibling[id]] = before;
+    }
+    sibling[id] = -1;
+    prev[id] = -1;
+}
+
+/**
+ * Insert a new element into the heap.
+ *
+ * @param element The (key, id) element to be inserted into the heap.
+ * @throws std::invalid_argument if the id is already in the heap.
+ */
+void PairingHeap::insert(std::pair<int, int> element)
+{
+    int id = element.second;
+    if (contains(id))
+    {
+        throw std::invalid_argument("Id is already in the heap");
+    }
+    keys[id] = element.first;
+    child[id] = -1;
+    sibling[id] = -1;
+    prev[id] = -1;
+    in_heap[id] = true;
+    root = _meld(root, id);
+    count++;
+}
+
+/**
+ * Lower the key of an id that is already in the heap.
+ *
+ * @param id  The id whose key is lowered.
+ * @param key The new key, which must not be larger than the current one.
+ * @throws std::invalid_argument if the id is not in the heap or the key would increase.
+ */
+void PairingHeap::decrease_key(int id, int key)
+{
+    if (!contains(id))
+    {
+        throw std::invalid_argument("Id is not in the heap");
+    }
+    if (key > keys[id])
+    {
+        throw std::invalid_argument("New key is larger than the current key");
+    }
+    keys[id] = key;
+    if (id != root)
+    {
+        _cut(id);
+        root = _meld(root, id);
+    }
+}
+
+/**
+ * Insert the id with the given key, or lower its key if it is already in the heap.
+ * A key that is not smaller than the stored one leaves the heap untouched.
+ *
+ * @param id  The id to insert or update.
+ * @param key The candidate key.
+ */
+void PairingHeap::insert_or_decrease(int id, int key)
+{
+    if (!contains(id))
+    {
+        insert({key, id});
+    }
+    else if (key < keys[id])
+    {
+        decrease_key(id, key);
+    }
+}
+
+/**
+ * Check if the id is currently in the heap.
+ *
+ * @param id The id to look for.
+ * @return True if the id is in the heap, otherwise false.
+ */
+bool PairingHeap::contains(int id) const
+{
+    return in_heap[id];
+}
+
+/**
+ * Get the minimum element from the heap (the root).
+ *
+ * @return The minimum element in the heap.
+ * @throws std::runtime_error if the heap is empty.
+ */
+std::pair<int, int> PairingHeap::get_min() const
+{
+    if (root == -1)
+    {
+        throw std::runtime_error("Heap is empty");
+    }
+    return {keys[root], root};
+}
+
+/**
+ * Extract and remove the minimum element from the heap. The root's children are melded in
+ * pairs from left to right, then the pairs are melded from right to left.
+ *
+ * @return The extracted minimum element.
+ * @throws std::runtime_error if the heap is empty.
+ */
+std::pair<int, int> PairingHeap::extract_min()
+{
+    if (root == -1)
+    {
+        throw std::runtime_error("Heap is empty");
+    }
+    std::pair<int, int> min_val = {keys[root], root};
+
+    pairs.clear();
+    int current = child[root];
+    while (current != -1)
+    {
+        int first = current;
+        int second = sibling[first];
+        current = second == -1 ? -1 : sibling[second];
+
+        sibling[first] = -1;
+        prev[first] = -1;
+        if (second != -1)
+        {
+            sibling[second] = -1;
+            prev[second] = -1;
+        }
+        pairs.push_back(_meld(first, second));
+    }
+
+    int new_root = -1;
+    for (auto it = pairs.rbegin(); it != pairs.rend(); ++it)
+    {
+        new_root = _meld(new_root, *it);
+    }
+
+    in_heap[root] = false;
+    child[root] = -1;
+    root = new_root;
+    count--;
+    return min_val;
+}
+
+/**
+ * Remove every element from the heap. The remaining trees are walked depth first to unmark their
+ * nodes, so clearing a nearly empty heap is cheap regardless of its capacity.
+ */
+void PairingHeap::clear()
+{
+    pairs.clear();
+    if (root != -1)
+    {
+        pairs.push_back(root);
+    }
+    while (!pairs.empty())
+    {
+        int node = pairs.back();
+        pairs.pop_back();
+        for (int current = child[node]; current != -1; current = sibling[current])
+        {
+            pairs.push_back(current);
+        }
+        in_heap[node] = false;
+    }
+    root = -1;
+    count = 0;
+}
+
+/**
+ * Check if the heap is empty.
+ *
+ * @return True if the heap is empty, otherwise false.
+ */
+bool PairingHeap::is_empty() const
+{
+    return root == -1;
+}
+
+/**
+ * Get the current size (number of elements) of the heap.
+ *
+ * @return The number of elements in the heap.
+ */
+int PairingHeap::size() const
+{
+    return count;
+}
@@ -0,0 +1,62 @@
+#ifndef PAIRINGHEAP_H
+#define PAIRINGHEAP_H
+
+#include <vector>
+#include <stdexcept>
+
+// Indexed pairing heap of (key, id) pairs. Nodes are preallocated per id and linked by index,
+// so decrease_key is a constant-time cut and meld, and no memory is allocated after construction.
+// Offers the same interface as IndexedMinHeap, so it can be passed to Dijkstra and Prim.
+class PairingHeap {
+private:
+    std::vector<int> keys;
+    std::vector<int> child;       // First child of each node, -1 if none.
+    std::vector<int> sibling;     // Next sibling of each node, -1 if none.
+    std::vector<int> prev;        // Parent if the node is a first child, otherwise its left sibling.
+    std::vector<bool> in_heap;
+    std::vector<int> pairs;       // Scratch space for the two-pass merge in extract_min.
+    int root;
+    int count;
+
+    // Orders nodes by key, then by id, so ties resolve like the other heaps.
+    bool _less(int a, int b) const;
+
+    // Links two detached trees and returns the root of the result.
+    int _meld(int a, int b);
+
+    // Detaches a non-root node (and its subtree) from its parent.
+    void _cut(int id);
+
+public:
+    // Constructor to create an empty heap for ids in [0, capacity).
+    explicit PairingHeap(int capacity);
+
+    // Inserts a new (key, id) element; the id must not already be in the heap.
+    void insert(std::pair<int, int> element);
+
+    // Lowers the key of an id that is already in the heap.
+    void decrease_key(int id, int key);
+
+    // Inserts the id, or lowers its key if it is already in the heap with a larger one.
+    void insert_or_decrease(int id, int key);
+
+    // Checks if the id is currently in the heap.
+    bool contains(int id) const;
+
+    // Retrieves the minimum element (root) of the heap.
+    std::pair<int, int> get_min() const;
+
+    // Removes and returns the minimum element (root) from the heap.
+    std::pair<int, int> extract_min();
+
+    // Removes every element in O(size), keeping the capacity, so the heap can be reused.
+    void clear();
+
+    // Checks if the heap is empty.
+    bool is_empty() const;
+
+    // Returns the current size (number of elements) of the heap.
+    int size() const;
+};
+
+#endif // PAIRINGHEAP_H
@@ -0,0 +1,648 @@
+#ifndef GRAPHLIB_PARALLELALGORITHMS_H
+#define GRAPHLIB_PARALLELALGORITHMS_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <vector>
+#include "queryContext.h"
+#include "threadPool.h"
+
+// Distances between every source (row) and every target (column), stored row-major in one block.
+struct DistanceMatrix {
+    int rows = 0;
+    int cols = 0;
+    std::vector<int> values;  // values[row * cols + col]; std::numeric_limits<int>::max() if unreachable.
+
+    // Get the distance from sources[row] to targets[col].
+    int at(int row, int col) const
+    {
+        return values[static_cast<size_t>(row) * cols + col];
+    }
+};
+
+// Multi-threaded algorithm cores, generic over the same graph interface as graphAlgorithms.h.
+namespace graph_algorithms {
+
+// A tentative distance and the vertex it was reached from, packed into one word so both change
+// together in a single compare-and-swap. The distance sits in the high half, so comparing packed
+// values compares distances first.
+inline uint64_t pack_distance(int distance, int previous)
+{
+    return (static_cast<uint64_t>(static_cast<uint32_t>(distance)) << 32) | static_cast<uint32_t>(previous + 1);
+}
+
+inline int packed_distance(uint64_t packed)
+{
+    return static_cast<int>(packed >> 32);
+}
+
+inline int packed_previous(uint64_t packed)
+{
+    return static_cast<int>(static_cast<uint32_t>(packed)) - 1;
+}
+
+// Lower the packed distance of a vertex to distance (via previous) if that is an improvement.
+inline bool relax_packed(std::atomic<uint64_t> &slot, int distance, int previous)
+{
+    uint64_t desired = pack_distance(distance, previous);
+    uint64_t current = slot.load(std::memory_order_relaxed);
+    while (packed_distance(current) > distance)
+    {
+        if (slot.compare_exchange_weak(current, desired, std::memory_order_relaxed))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Largest number of buckets delta_stepping keeps in its cyclic window.
+const int DELTA_STEPPING_WINDOW = 1024;
+
+/**
+ * Computes the shortest distances from a source vertex with parallel delta-stepping.
+ *
+ * Tentative distances are grouped into buckets of width delta. The smallest non-empty bucket is
+ * settled in rounds: all its vertices relax their light edges (weight <= delta) in parallel, which
+ * may refill the same bucket, until it stays empty; then every vertex settled in it relaxes its heavy
+ * edges once. A small delta approaches Dijkstra's order with little parallelism per round, a large
+ * delta approaches Bellman-Ford with more parallelism but more re-relaxations.
+ *
+ * The buckets form a cyclic window of at most DELTA_STEPPING_WINDOW buckets, enough for every
+ * relaxation to land inside it when max_weight / delta is small. Vertices whose bucket lies past the
+ * window go to one overflow list instead; once the window is used up, it moves to the smallest bucket
+ * in that list and takes in the vertices that now fall inside it. A bitmap of non-empty buckets lets
+ * the search jump straight to the next bucket holding vertices. Each thread queues the vertices it
+ * improves in buffers of its own, one per bucket plus one for the overflow, and after every round the
+ * touched buckets take in those buffers in parallel, one bucket per task.
+ *
+ * @param graph          The graph to search.
+ * @param source         The index of the source vertex.
+ * @param previous_nodes A vector to store the previous node in the shortest path for each vertex.
+ * @param pool           The threads to run on.
+ * @param delta          The bucket width; <= 0 picks the average edge weight.
+ * @return A vector of shortest distances from the source to all other vertices.
+ */
+template <typename G>
+std::vector<int> delta_stepping(const G &graph, int source, std::vector<int> &previous_nodes, ThreadPool &pool, int delta = 0)
+{
+    const int max = std::numeric_limits<int>::max();
+    const int n = graph.num_verts();
+    const int threads = pool.num_threads();
+
+    std::vector<long long> weight_sums(threads, 0);
+    std::vector<long long> edge_counts(threads, 0);
+    std::vector<int> max_weights(threads, 0);
+    pool.parallel_for(0, n, [&](int t, int u)
+    {
+        graph.for_each_neighbor(u, [&](int, int weight)
+        {
+            weight_sums[t] += weight;
+            edge_counts[t]++;
+            max_weights[t] = std::max(max_weights[t], weight);
+        });
+    }, 1024);
+
+    long long weight_sum = 0;
+    long long edge_count = 0;
+    int max_weight = 0;
+    for (int t = 0; t < threads; t++)
+    {
+        weight_sum += weight_sums[t];
+        edge_count += edge_counts[t];
+        max_weight = std::max(max_weight, max_weights[t]);
+    }
+    if (delta <= 0)
+    {
+        delta = edge_count == 0 ? 1 : static_cast<int>(weight_sum / edge_count);
+        if (delta <= 0)
+        {
+            delta = 1;
+        }
+    }
+
+    std::vector<std::atomic<uint64_t>> state(n);
+    pool.parallel_for(0, n, [&](int, int v)
+    {
+        state[v].store(pack_distance(max, -1), std::memory_order_relaxed);
+    }, 4096);
+    state[source].store(pack_distance(0, -1), std::memory_order_relaxed);
+
+    const int num_buckets = static_cast<int>(std::min<long long>(max_weight / delta + 2, DELTA_STEPPING_WINDOW));
+    std::vector<std::vector<int>> buckets(num_buckets);  // Vertices by bucket index modulo num_buckets, possibly stale or repeated.
+    std::vector<uint64_t> occupied((num_buckets + 63) / 64, 0);  // Bit i is set when buckets[i] is not empty.
+    std::vector<int> overflow;                           // Vertices queued for buckets past the window.
+    int overflow_start = max;                            // Smallest bucket index queued in the overflow.
+    std::vector<std::vector<std::vector<int>>> pending(threads, std::vector<std::vector<int>>(num_buckets));
+    std::vector<std::vector<int>> pending_overflow(threads);
+    std::vector<int> pending_overflow_start(threads, max);
+    std::vector<std::vector<int>> touched(threads);      // Buckets each thread queued vertices for in the current round.
+    std::vector<char> is_touched(num_buckets, 0);
+    std::vector<int> merging;
+    std::vector<int> expanded_at(n, -1);                 // Distance at which each vertex last relaxed its light edges.
+    std::vector<int> frontier;
+    std::vector<int> settled;
+    size_t queued = 1;                                   // Entries in all buckets and the overflow together.
+    int current = 0;                                     // Bucket being settled; the window starts here.
+    buckets[0].push_back(source);
+    occupied[0] = 1;
+
+    // Queue an improved vertex in the calling thread's buffer for the bucket of its new distance.
+    auto queue = [&](int t, int v, int distance)
+    {
+        int index = distance / delta;
+        if (index - current >= num_buckets)
+        {
+            pending_overflow[t].push_back(v);
+            pending_overflow_start[t] = std::min(pending_overflow_start[t], index);
+            return;
+        }
+        int bucket = index % num_buckets;
+        if (pending[t][bucket].empty())
+        {
+            touched[t].push_back(bucket);
+        }
+        pending[t][bucket].push_back(v);
+    };
+
+    // Move the vertices queued by every thread into their buckets, one bucket per task.
+    auto merge_pending = [&]()
+    {
+        merging.clear();
+        for (int t = 0; t < threads; t++)
+        {
+            for (int bucket : touched[t])
+            {
+                queued += pending[t][bucket].size();
+                if (!is_touched[bucket])
+                {
+                    is_touched[bucket] = 1;
+                    merging.push_back(bucket);
+                    occupied[bucket / 64] |= uint64_t(1) << (bucket % 64);
+                }
+            }
+            touched[t].clear();
+
+            queued += pending_overflow[t].size();
+            overflow.insert(overflow.end(), pending_overflow[t].begin(), pending_overflow[t].end());
+            overflow_start = std::min(overflow_start, pending_overflow_start[t]);
+            pending_overflow[t].clear();
+            pending_overflow_start[t] = max;
+        }
+        pool.parallel_for(0, static_cast<int>(merging.size()), [&](int, int i)
+        {
+            int bucket = merging[i];
+            is_touched[bucket] = 0;
+            for (int t = 0; t < threads; t++)
+            {
+                buckets[bucket].insert(buckets[bucket].end(), pending[t][bucket].begin(), pending[t][bucket].end());
+                pending[t][bucket].clear();
+            }
+        }, 1);
+    };
+
+    // Find the first non-empty bucket with an index in [current, end), or -1, reading the bitmap a word
+    // at a time.
+    auto next_bucket = [&](int end)
+    {
+        int index = current;
+        while (index < end)
+        {
+            int bucket = index % num_buckets;
+            int span = std::min({64 - bucket % 64, num_buckets - bucket, end - index});
+            uint64_t word = occupied[bucket / 64] >> (bucket % 64);
+            if (span < 64)
+            {
+                word &= (uint64_t(1) << span) - 1;
+            }
+            if (word != 0)
+            {
+                return index + __builtin_ctzll(word);
+            }
+            index += span;
+        }
+        return -1;
+    };
+
+    // Move the window to the smallest bucket in the overflow and take in the overflow vertices that now
+    // fall inside it. Entries whose vertex has since reached an earlier bucket are stale and dropped.
+    auto refill_window = [&]()
+    {
+        current = overflow_start;
+        overflow_start = max;
+        size_t kept_count = 0;
+        for (int v : overflow)
+        {
+            int index = packed_distance(state[v].load(std::memory_order_relaxed)) / delta;
+            if (index < current)
+            {
+                queued--;
+            }
+            else if (index - current < num_buckets)
+            {
+                int bucket = index % num_buckets;
+                buckets[bucket].push_back(v);
+                occupied[bucket / 64] |= uint64_t(1) << (bucket % 64);
+            }
+            else
+            {
+                overflow[kept_count++] = v;
+                overflow_start = std::min(overflow_start, index);
+            }
+        }
+        overflow.resize(kept_count);
+    };
+
+    while (queued > 0)
+    {
+        // No bucket past the smallest one in the overflow may be settled before the overflow is split.
+        int next = next_bucket(static_cast<int>(std::min<long long>(static_cast<long long>(current) + num_buckets, overflow_start)));
+        if (next == -1)
+        {
+            refill_window();
+            continue;
+        }
+        current = next;
+        std::vector<int> &bucket = buckets[current % num_buckets];
+        settled.clear();
+
+        while (!bucket.empty())
+        {
+            frontier.clear();
+            for (int v : bucket)
+            {
+                int d = packed_distance(state[v].load(std::memory_order_relaxed));
+                if (d / delta == current && expanded_at[v] != d)
+                {
+                    expanded_at[v] = d;
+                    frontier.push_back(v);
+                    settled.push_back(v);
+                }
+            }
+            queued -= bucket.size();
+            bucket.clear();
+            occupied[(current % num_buckets) / 64] &= ~(uint64_t(1) << ((current % num_buckets) % 64));
+
+            pool.parallel_for(0, static_cast<int>(frontier.size()), [&](int t, int i)
+            {
+                int u = frontier[i];
+                int du = packed_distance(state[u].load(std::memory_order_relaxed));
+                graph.for_each_neighbor(u, [&](int v, int weight)
+                {
+                    if (weight <= delta && relax_packed(state[v], du + weight, u))
+                    {
+                        queue(t, v, du + weight);
+                    }
+                });
+            }, 16);
+            merge_pending();
+        }
+
+        pool.parallel_for(0, static_cast<int>(settled.size()), [&](int t, int i)
+        {
+            int u = settled[i];
+            int du = packed_distance(state[u].load(std::memory_order_relaxed));
+            graph.for_each_neighbor(u, [&](int v, int weight)
+            {
+                if (weight > delta && relax_packed(state[v], du + weight, u))
+                {
+                    queue(t, v, du + weight);
+                }
+            });
+        }, 16);
+        merge_pending();
+    }
+
+    std::vector<int> distances(n);
+    for (int v = 0; v < n; v++)
+    {
+        uint64_t packed = state[v].load(std::memory_order_relaxed);
+        distances[v] = packed_distance(packed);
+        if (packed_previous(packed) != -1)
+        {
+            previous_nodes[v] = packed_previous(packed);
+        }
+    }
+    return distances;
+}
+
+/**
+ * Computes the distance from every source to every target, one Dijkstra search per source, with the
+ * sources spread over the pool's threads. Each thread reuses one QueryContext for all the sources
+ * it handles, so no search refills or reallocates per-vertex arrays. A search stops as soon as every
+ * target is settled.
+ *
+ * @param graph   The graph to search.
+ * @param sources The indices of the source vertices (matrix rows).
+ * @param targets The indices of the target vertices (matrix columns).
+ * @param pool    The threads to run on.
+ * @return The distance matrix.
+ */
+template <typename G>
+DistanceMatrix distance_matrix(const G &graph, const std::vector<int> &sources, const std::vector<int> &targets, ThreadPool &pool)
+{
+    const int max = std::numeric_limits<int>::max();
+    const int n = graph.num_verts();
+
+    DistanceMatrix matrix;
+    matrix.rows = static_cast<int>(sources.size());
+    matrix.cols = static_cast<int>(targets.size());
+    matrix.values.assign(static_cast<size_t>(matrix.rows) * matrix.cols, max);
+
+    std::vector<char> is_target(n, 0);
+    int distinct_targets = 0;
+    for (int t : targets)
+    {
+        if (!is_target[t])
+        {
+            is_target[t] = 1;
+            distinct_targets++;
+        }
+    }
+
+    // One query context per thread, reused for every source it handles.
+    std::vector<QueryContext> contexts(pool.num_threads());
+
+    pool.parallel_for(0, matrix.rows, [&](int thread_index, int row)
+    {
+        QueryContext &context = contexts[thread_index];
+        context.prepare(n);
+
+        int source = sources[row];
+        context.set(source, 0, -1);
+        IndexedMinHeap &heap = context.heap();
+        heap.insert({0, source});
+
+        int remaining = distinct_targets;
+        while (!heap.is_empty() && remaining > 0)
+        {
+            auto [du, u] = heap.extract_min();
+            if (is_target[u])
+            {
+                remaining--;
+            }
+            graph.for_each_neighbor(u, [&](int v, int weight)
+            {
+                if (du + weight < context.distance(v))
+                {
+                    context.set(v, du + weight, u);
+                    heap.insert_or_decrease(v, du + weight);
+                }
+            });
+        }
+
+        int *out = matrix.values.data() + static_cast<size_t>(row) * matrix.cols;
+        for (int col = 0; col < matrix.cols; col++)
+        {
+            out[col] = context.distance(targets[col]);
+        }
+    }, 1);
+
+    return matrix;
+}
+
+// A candidate spanning forest edge packed into one word: the weight (sign bit flipped, so negative
+// weights order first) in the high half and the edge id in the low half. Comparing packed values
+// compares weights first and breaks ties by edge id, which gives every edge a distinct rank.
+inline uint64_t pack_edge(int weight, int edge)
+{
+    return (static_cast<uint64_t>(static_cast<uint32_t>(weight) ^ 0x80000000u) << 32) | static_cast<uint32_t>(edge);
+}
+
+inline int packed_edge(uint64_t packed)
+{
+    return static_cast<int>(static_cast<uint32_t>(packed));
+}
+
+// Lower a packed edge slot to packed if that is an improvement.
+inline void lower_packed_edge(std::atomic<uint64_t> &slot, uint64_t packed)
+{
+    uint64_t current = slot.load(std::memory_order_relaxed);
+    while (packed < current && !slot.compare_exchange_weak(current, packed, std::memory_order_relaxed))
+    {
+    }
+}
+
+/**
+ * Calculates a minimum spanning forest with parallel Borůvka rounds.
+ *
+ * Each round, every edge between two components offers itself to both of them with a lock-free
+ * compare-and-swap minimum, so each component ends up with its lightest outgoing edge. Every component
+ * then hooks onto the component across that edge; ties are broken by edge order, so the only cycles are
+ * pairs that picked the same edge, and the smaller of the pair stays a root. Pointer jumping flattens
+ * the hooks, the surviving edges are rewritten to connect the new roots, and edges inside a component
+ * are dropped. The number of components at least halves per round.
+ *
+ * @param graph The graph to span.
+ * @param pool  The threads to run on.
+ * @return The forest edges as (from index, to index, weight) with from < to, in increasing weight order.
+ *         Since ties are broken the same way, this is exactly the forest kruskal() returns.
+ */
+template <typename G>
+std::vector<std::tuple<int, int, int>> boruvka(const G &graph, ThreadPool &pool)
+{
+    const int n = graph.num_verts();
+    const int num_threads = pool.num_threads();
+    const uint64_t none = std::numeric_limits<uint64_t>::max();
+    const int grain = 4096;
+
+    // Number every edge u < v in adjacency order, the order in which kruskal() breaks weight ties.
+    std::vector<int> first_edge(n + 1, 0);
+    pool.parallel_for(0, n, [&](int, int u)
+    {
+        int count = 0;
+        graph.for_each_neighbor(u, [&](int v, int)
+        {
+            count += u < v;
+        });
+        first_edge[u + 1] = count;
+    }, grain);
+    for (int u = 0; u < n; u++)
+    {
+        first_edge[u + 1] += first_edge[u];
+    }
+
+    // Every edge by its number, as it is in the graph; contraction never rewrites these.
+    const int m = first_edge[n];
+    std::vector<int> edge_sources(m);
+    std::vector<int> edge_targets(m);
+    std::vector<int> edge_weights(m);
+    pool.parallel_for(0, n, [&](int, int u)
+    {
+        int e = first_edge[u];
+        graph.for_each_neighbor(u, [&](int v, int weight)
+        {
+            if (u < v)
+            {
+                edge_sources[e] = u;
+                edge_targets[e] = v;
+                edge_weights[e] = weight;
+                e++;
+            }
+        });
+    }, grain);
+
+    // The edges still in play, in edge order. ends[0] and ends[1] hold the components the edge
+    // currently joins, which start out as its endpoints; ids holds its index in the original numbering.
+    std::vector<int> ends[2] = {edge_sources, edge_targets};
+    std::vector<int> weights = edge_weights;
+    std::vector<int> ids(m);
+    pool.parallel_for(0, m, [&](int, int e)
+    {
+        ids[e] = e;
+    }, grain);
+    std::vector<int> spare_ends[2] = {std::vector<int>(m), std::vector<int>(m)};
+    std::vector<int> spare_weights(m);
+    std::vector<int> spare_ids(m);
+
+    std::vector<int> parent(n);         // Component each root hooks onto this round.
+    std::vector<int> jumped(n);         // Scratch for pointer jumping.
+    std::vector<int> roots(n);          // Components still in play.
+    std::vector<int> picked(n);         // Original id of the edge each root hooked along this round, or -1.
+    std::vector<std::atomic<uint64_t>> lightest(n);
+    std::vector<size_t> kept(num_threads + 1);
+    std::vector<int> forest_ids;
+    for (int v = 0; v < n; v++)
+    {
+        roots[v] = v;
+    }
+
+    size_t count = m;
+    while (count > 0)
+    {
+        const int num_roots = static_cast<int>(roots.size());
+        pool.parallel_for(0, num_roots, [&](int, int i)
+        {
+            lightest[roots[i]].store(none, std::memory_order_relaxed);
+        }, grain);
+
+        // Edges are ranked by their position in the surviving list, which preserves edge order.
+        pool.parallel_for(0, static_cast<int>(count), [&](int, int i)
+        {
+            uint64_t packed = pack_edge(weights[i], i);
+            lower_packed_edge(lightest[ends[0][i]], packed);
+            lower_packed_edge(lightest[ends[1][i]], packed);
+        }, grain);
+
+        pool.parallel_for(0, num_roots, [&](int, int i)
+        {
+            int c = roots[i];
+            parent[c] = c;
+            picked[i] = -1;
+
+            uint64_t packed = lightest[c].load(std::memory_order_relaxed);
+            if (packed == none)
+            {
+                return;
+            }
+            int e = packed_edge(packed);
+            int other = ends[0][e] == c ? ends[1][e] : ends[0][e];
+            if (c < other && lightest[other].load(std::memory_order_relaxed) == packed)
+            {
+                return;
+            }
+            parent[c] = other;
+            picked[i] = ids[e];
+        }, grain);
+
+        size_t forest_size = forest_ids.size();
+        for (int i = 0; i < num_roots; i++)
+        {
+            if (picked[i] != -1)
+            {
+                forest_ids.push_back(picked[i]);
+            }
+        }
+        if (forest_ids.size() == forest_size)
+        {
+            break;
+        }
+
+        std::atomic<bool> changed(true);
+        while (changed.load())
+        {
+            changed.store(false);
+            pool.parallel_for(0, num_roots, [&](int, int i)
+            {
+                int c = roots[i];
+                jumped[c] = parent[parent[c]];
+                if (jumped[c] != parent[c])
+                {
+                    changed.store(true, std::memory_order_relaxed);
+                }
+            }, grain);
+            pool.parallel_for(0, num_roots, [&](int, int i)
+            {
+                parent[roots[i]] = jumped[roots[i]];
+            }, grain);
+        }
+        roots.erase(std::remove_if(roots.begin(), roots.end(), [&](int c) { return parent[c] != c; }), roots.end());
+
+        // Move every edge onto the new roots and compact the ones that still cross components to the
+        // front of each thread's slice, then gather the slices in order into the spare arrays.
+        pool.run_on_all([&](int thread_index)
+        {
+            size_t begin = count * thread_index / num_threads;
+            size_t end = count * (thread_index + 1) / num_threads;
+            size_t out = begin;
+            for (size_t i = begin; i < end; i++)
+            {
+                int cu = parent[ends[0][i]];
+                int cv = parent[ends[1][i]];
+                if (cu != cv)
+                {
+                    ends[0][out] = cu;
+                    ends[1][out] = cv;
+                    weights[out] = weights[i];
+                    ids[out] = ids[i];
+                    out++;
+                }
+            }
+            kept[thread_index + 1] = out - begin;
+        });
+        for (int t = 0; t < num_threads; t++)
+        {
+            kept[t + 1] += kept[t];
+        }
+        pool.run_on_all([&](int thread_index)
+        {
+            size_t begin = count * thread_index / num_threads;
+            size_t length = kept[thread_index + 1] - kept[thread_index];
+            for (int k = 0; k < 4; k++)
+            {
+                const int *from = (k < 2 ? ends[k] : k == 2 ? weights : ids).data() + begin;
+                int *to = (k < 2 ? spare_ends[k] : k == 2 ? spare_weights : spare_ids).data() + kept[thread_index];
+                std::copy(from, from + length, to);
+            }
+        });
+        ends[0].swap(spare_ends[0]);
+        ends[1].swap(spare_ends[1]);
+        weights.swap(spare_weights);
+        ids.swap(spare_ids);
+        count = kept[num_threads];
+    }
+
+    // Sorting the forest edges by packed rank lists them in Kruskal's order.
+    std::vector<std::pair<uint64_t, std::tuple<int, int, int>>> ranked(forest_ids.size());
+    pool.parallel_for(0, static_cast<int>(forest_ids.size()), [&](int, int i)
+    {
+        int e = forest_ids[i];
+        ranked[i] = {pack_edge(edge_weights[e], e), std::make_tuple(edge_sources[e], edge_targets[e], edge_weights[e])};
+    }, grain);
+    std::sort(ranked.begin(), ranked.end());
+
+    std::vector<std::tuple<int, int, int>> forest;
+    forest.reserve(ranked.size());
+    for (const auto &edge : ranked)
+    {
+        forest.push_back(edge.second);
+    }
+    return forest;
+}
+
+} // namespace graph_algorithms
+
+#endif //GRAPHLIB_PARALLELALGORITHMS_H
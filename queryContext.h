@@ -0,0 +1,119 @@
+#ifndef GRAPHLIB_QUERYCONTEXT_H
+#define GRAPHLIB_QUERYCONTEXT_H
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+#include "indexedMinHeap.h"
+
+// Search buffers that can be reused from one shortest-path query to the next.
+//
+// Every vertex entry carries the generation of the query that last wrote it. prepare() starts a new
+// query by bumping the generation, which makes every entry read as unreached again without touching
+// it, and clears the heaps in time proportional to what the previous query left in them. Once the
+// buffers have grown to the size of the graph, a query allocates nothing.
+//
+// Side 0 holds a one-sided search, or the forward half of a bidirectional one; side 1 holds the
+// backward half. A context serves one query at a time, so use one per thread.
+template <typename Heap>
+class BasicQueryContext {
+
+    // The search state of one vertex on one side.
+    struct Entry {
+        unsigned int generation;
+        int distance;
+        int previous;
+        int hops;
+    };
+
+    int capacity;                  // Number of vertices the buffers currently cover.
+    unsigned int generation;       // Generation of the current query; entries with another value are stale.
+    std::vector<Entry> entries[2]; // Per-vertex state of each side.
+    std::vector<Heap> heaps;       // Priority queue of each side.
+    std::vector<int> path_buffer;  // Vertex indices of the last path found.
+
+public:
+
+    // Constructor to create an empty context; the buffers grow on the first query.
+    BasicQueryContext() : capacity(0), generation(0), heaps(2, Heap(0)) {}
+
+    // Start a new query on a graph with n vertices, growing the buffers if the graph got larger.
+    void prepare(int n)
+    {
+        if (n > capacity)
+        {
+            for (auto &side : entries)
+            {
+                side.resize(n, Entry{0, 0, -1, 0});
+            }
+            heaps.assign(2, Heap(n));
+            capacity = n;
+        }
+        else
+        {
+            heaps[0].clear();
+            heaps[1].clear();
+        }
+
+        // After 2^32 queries the generation wraps around and old entries could look current again.
+        if (++generation == 0)
+        {
+            for (auto &side : entries)
+            {
+                std::fill(side.begin(), side.end(), Entry{0, 0, -1, 0});
+            }
+            generation = 1;
+        }
+        path_buffer.clear();
+    }
+
+    // Get the tentative distance of a vertex, or std::numeric_limits<int>::max() if this query has not reached it.
+    int distance(int v, int side = 0) const
+    {
+        const Entry &entry = entries[side][v];
+        return entry.generation == generation ? entry.distance : std::numeric_limits<int>::max();
+    }
+
+    // Get the vertex v was reached from, or -1 if it is the start of the search or was not reached.
+    int previous(int v, int side = 0) const
+    {
+        const Entry &entry = entries[side][v];
+        return entry.generation == generation ? entry.previous : -1;
+    }
+
+    // Get the number of edges on the search tree branch leading to v, or 0 if it was not reached.
+    int hops(int v, int side = 0) const
+    {
+        const Entry &entry = entries[side][v];
+        return entry.generation == generation ? entry.hops : 0;
+    }
+
+    // Record the tentative distance of a vertex, the vertex it was reached from and its hop count.
+    void set(int v, int distance, int previous, int hops = 0, int side = 0)
+    {
+        entries[side][v] = Entry{generation, distance, previous, hops};
+    }
+
+    // Get the priority queue of one side.
+    Heap &heap(int side = 0)
+    {
+        return heaps[side];
+    }
+
+    // Get the vertex indices of the last path found, empty if the target was not reached.
+    std::vector<int> &path()
+    {
+        return path_buffer;
+    }
+
+    const std::vector<int> &path() const
+    {
+        return path_buffer;
+    }
+
+};
+
+// The context used by the library's own queries.
+using QueryContext = BasicQueryContext<IndexedMinHeap>;
+
+#endif //GRAPHLIB_QUERYCONTEXT_H
@@ -0,0 +1,226 @@
+#include "radixHeap.h"
+
+/**
+ * Constructor to create an empty heap able to hold every id in [0, capacity).
+ *
+ * @param capacity The number of distinct ids the heap can hold.
+ */
+RadixHeap::RadixHeap(int capacity) : bucket_of(capacity, -1), slot_of(capacity, -1), last_deleted(0), count(0) {}
+
+/**
+ * Private function computing the bucket for a key: 0 if it equals the last extracted key,
+ * otherwise one plus the index of the highest bit in which the two differ.
+ *
+ * @param key The key to classify.
+ * @return The bucket index in [0, NUM_BUCKETS).
+ */
+int RadixHeap::_bucket_index(unsigned int key) const
+{
+    unsigned int diff = key ^ last_deleted;
+    if (diff == 0)
+    {
+        return 0;
+    }
+#if defined(__GNUC__) || defined(__clang__)
+    return 32 - __builtin_clz(diff);
+#else
+    int bucket = 0;
+    while (diff != 0)
+    {
+        diff >>= 1;
+        bucket++;
+    }
+    return bucket;
+#endif
+}
+
+/**
+ * Private function appending an element to its bucket and recording where it went.
+ *
+ * @param element The (key, id) element to store.
+ */
+void RadixHeap::_place(std::pair<int, int> element)
+{
+    int bucket = _bucket_index(element.first);
+    bucket_of[element.second] = bucket;
+    slot_of[element.second] = buckets[bucket].size();
+    buckets[bucket].push_back(element);
+}
+
+/**
+ * Private function removing an id from its bucket by moving the bucket's last element into its slot.
+ *
+ * @param id The id to remove.
+ */
+void RadixHeap::_remove(int id)
+{
+    std::vector<std::pair<int, int>> &bucket = buckets[bucket_of[id]];
+    int slot = slot_of[id];
+    bucket[slot] = bucket.back();
+    slot_of[bucket[slot].second] = slot;
+    bucket.pop_back();
+    bucket_of[id] = -1;
+}
+
+/**
+ * Insert a new element into the heap.
+ *
+ * @param element The (key, id) element to be inserted into the heap.
+ * @throws std::invalid_argument if the id is already in the heap or the key is below the last extracted key.
+ */
+void RadixHeap::insert(std::pair<int, int> element)
+{
+    if (contains(element.second))
+    {
+        throw std::invalid_argument("Id is already in the heap");
+    }
+    if (element.first < 0 || static_cast<unsigned int>(element.first) < last_deleted)
+    {
+        throw std::invalid_argument("Radix heap keys must not drop below the last extracted key");
+    }
+    _place(element);
+    count++;
+}
+
+/**
+ * Lower the key of an id that is already in the heap.
+ *
+ * @param id  The id whose key is lowered.
+ * @param key The new key, between the last extracted key and the current key.
+ * @throws std::invalid_argument if the id is not in the heap or the key is out of range.
+ */
+void RadixHeap::decrease_key(int id, int key)
+{
+    if (!contains(id))
+    {
+        throw std::invalid_argument("Id is not in the heap");
+    }
+    if (key > buckets[bucket_of[id]][slot_of[id]].first)
+    {
+        throw std::invalid_argument("New key is larger than the current key");
+    }
+    if (key < 0 || static_cast<unsigned int>(key) < last_deleted)
+    {
+        throw std::invalid_argument("Radix heap keys must not drop below the last extracted key");
+    }
+    _remove(id);
+    _place({key, id});
+}
+
+/**
+ * Insert the id with the given key, or lower its key if it is already in the heap.
+ * A key that is not smaller than the stored one leaves the heap untouched.
+ *
+ * @param id  The id to insert or update.
+ * @param key The candidate key.
+ */
+void RadixHeap::insert_or_decrease(int id, int key)
+{
+    if (!contains(id))
+    {
+        insert({key, id});
+    }
+    else if (key < buckets[bucket_of[id]][slot_of[id]].first)
+    {
+        decrease_key(id, key);
+    }
+}
+
+/**
+ * Check if the id is currently in the heap.
+ *
+ * @param id The id to look for.
+ * @return True if the id is in the heap, otherwise false.
+ */
+bool RadixHeap::contains(int id) const
+{
+    return bucket_of[id] != -1;
+}
+
+/**
+ * Extract and remove the minimum element from the heap. When bucket 0 is empty, the first
+ * non-empty bucket is redistributed around its smallest key, which then lands in bucket 0.
+ *
+ * @return The extracted minimum element.
+ * @throws std::runtime_error if the heap is empty.
+ */
+std::pair<int, int> RadixHeap::extract_min()
+{
+    if (count == 0)
+    {
+        throw std::runtime_error("Heap is empty");
+    }
+
+    if (buckets[0].empty())
+    {
+        int bucket = 1;
+        while (buckets[bucket].empty())
+        {
+            bucket++;
+        }
+
+        std::vector<std::pair<int, int>> &pending = buckets[bucket];
+
+        unsigned int min_key = pending[0].first;
+        for (const auto &element : pending)
+        {
+            if (static_cast<unsigned int>(element.first) < min_key)
+            {
+                min_key = element.first;
+            }
+        }
+        last_deleted = min_key;
+
+        // Every element moves to a strictly lower bucket, so pending is never appended to while it is
+        // walked. Clearing it afterwards keeps its capacity for the next elements that land there.
+        for (const auto &element : pending)
+        {
+            _place(element);
+        }
+        pending.clear();
+    }
+
+    std::pair<int, int> min_val = buckets[0].back();
+    buckets[0].pop_back();
+    bucket_of[min_val.second] = -1;
+    count--;
+    return min_val;
+}
+
+/**
+ * Remove every element from the heap and reset the last extracted key, so keys may start from zero again.
+ * Only the ids still in the heap are touched.
+ */
+void RadixHeap::clear()
+{
+    for (auto &bucket : buckets)
+    {
+        for (const auto &element : bucket)
+        {
+            bucket_of[element.second] = -1;
+        }
+        bucket.clear();
+    }
+    last_deleted = 0;
+    count = 0;
+}
+
+/**
+ * Check if the heap is empty.
+ *
+ * @return True if the heap is empty, otherwise false.
+ */
+bool RadixHeap::is_empty() const
+{
+    return count == 0;
+}
+
+/**
+ * Get the current size (number of elements) of the heap.
+ *
+ * @return The number of elements in the heap.
+ */
+int RadixHeap::size() const
+{
+    return count;
+}
@@ -0,0 +1,68 @@
+#ifndef RADIXHEAP_H
+#define RADIXHEAP_H
+
+#include <type_traits>
+#include <vector>
+#include <stdexcept>
+
+// Indexed monotone radix heap of (key, id) pairs with non-negative integer keys.
+// An element lives in the bucket named after the highest bit in which its key differs from
+// the last extracted key, so extract_min only redistributes one bucket at a time and never
+// compares keys across buckets. Keys may never drop below the last extracted minimum, which
+// holds for Dijkstra with non-negative weights but not for Prim.
+class RadixHeap {
+private:
+    static const int NUM_BUCKETS = 33; // Bucket 0 holds keys equal to last_deleted, bucket b > 0 differs at bit b - 1.
+
+    std::vector<std::pair<int, int>> buckets[NUM_BUCKETS];
+    std::vector<int> bucket_of;   // Bucket of each id, -1 if the id is not in the heap.
+    std::vector<int> slot_of;     // Index of each id inside its bucket.
+    unsigned int last_deleted;    // The most recently extracted key.
+    int count;
+
+    // Returns the bucket an element with the given key belongs to.
+    int _bucket_index(unsigned int key) const;
+
+    // Appends an element to the bucket its key belongs to.
+    void _place(std::pair<int, int> element);
+
+    // Removes an id from its bucket in O(1).
+    void _remove(int id);
+
+public:
+    // Constructor to create an empty heap for ids in [0, capacity).
+    explicit RadixHeap(int capacity);
+
+    // Inserts a new (key, id) element; the id must not already be in the heap.
+    void insert(std::pair<int, int> element);
+
+    // Lowers the key of an id that is already in the heap.
+    void decrease_key(int id, int key);
+
+    // Inserts the id, or lowers its key if it is already in the heap with a larger one.
+    void insert_or_decrease(int id, int key);
+
+    // Checks if the id is currently in the heap.
+    bool contains(int id) const;
+
+    // Removes and returns the minimum element from the heap.
+    std::pair<int, int> extract_min();
+
+    // Removes every element in O(size) and forgets the last extracted key, so the heap can be reused.
+    void clear();
+
+    // Checks if the heap is empty.
+    bool is_empty() const;
+
+    // Returns the current size (number of elements) of the heap.
+    int size() const;
+};
+
+// Heaps that require keys to never drop below the last extracted minimum.
+template <typename Heap>
+struct is_monotone_heap : std::false_type {};
+
+template <>
+struct is_monotone_heap<RadixHeap> : std::true_type {};
+
+#endif // RADIXHEAP_H
@@ -0,0 +1,67 @@
+#include <cmath>
+#include <random>
+#include <utility>
+#include <vector>
+#include "astarHeuristics.h"
+#include "testSupport.h"
+
+using namespace test_support;
+
+// A* gives the reference distance and a path of that length with the zero, ALT and coordinate
+// heuristics, none of which ever overestimates.
+int main()
+{
+    auto zero = [](int, int) { return 0; };
+
+    for (unsigned seed = 1; seed <= 8; seed++)
+    {
+        // Vertices on a plane; every edge weighs at least the straight-line distance between its ends.
+        const int n = 60;
+        std::mt19937 random(seed);
+        std::uniform_real_distribution<double> coordinate(0.0, 100.0);
+        std::uniform_int_distribution<int> vertex(0, n - 1);
+        std::uniform_int_distribution<int> detour(0, 20);
+        std::vector<std::pair<double, double> > coordinates(n);
+        for (auto &point : coordinates)
+        {
+            point = {coordinate(random), coordinate(random)};
+        }
+        Graph graph;
+        graph.add_vertices(n);
+        for (int e = 0; e < 50 + 15 * static_cast<int>(seed); e++)
+        {
+            int from = vertex(random);
+            int to = vertex(random);
+            double length = std::hypot(coordinates[from].first - coordinates[to].first, coordinates[from].second - coordinates[to].second);
+            graph.add_edge(from, to, static_cast<int>(std::ceil(length)) + detour(random));
+        }
+
+        CsrGraph csr = graph.freeze();
+        CoordinateHeuristic straight_line(coordinates);
+        AltHeuristic landmarks(csr, 4);
+        QueryContext context;
+        for (int source = 0; source < n; source++)
+        {
+            std::vector<int> expected = reference_distances(graph, source);
+            for (int target = 0; target < n; target++)
+            {
+                CHECK(straight_line(source, target) <= expected[target]);
+                CHECK(landmarks(source, target) <= expected[target]);
+
+                std::vector<int> path;
+                CHECK(graph_algorithms::astar(graph, source, target, zero, path) == expected[target]);
+                CHECK(graph_algorithms::astar(csr, source, target, straight_line, context) == expected[target]);
+                CHECK(graph_algorithms::astar(csr, source, target, landmarks, path) == expected[target]);
+                if (expected[target] == UNREACHABLE)
+                {
+                    CHECK(path.empty() && context.path().empty());
+                    continue;
+                }
+                CHECK(path.front() == source && path.back() == target);
+                CHECK(path_length(csr, path) == expected[target]);
+                CHECK(path_length(csr, context.path()) == expected[target]);
+            }
+        }
+    }
+    return result();
+}
@@ -0,0 +1,37 @@
+#include <vector>
+#include "graphAlgorithms.h"
+#include "testSupport.h"
+
+using namespace test_support;
+
+// Bidirectional Dijkstra gives the reference distance between every pair and a path of that length,
+// on both graph representations, and an empty path for unreachable targets.
+int main()
+{
+    for (unsigned seed = 1; seed <= 10; seed++)
+    {
+        Graph graph = random_graph(50, 30 + 10 * static_cast<int>(seed), seed % 2 ? 9 : 500, seed);
+        CsrGraph csr = graph.freeze();
+        QueryContext context;
+        for (int source = 0; source < graph.num_verts(); source++)
+        {
+            std::vector<int> expected = reference_distances(graph, source);
+            for (int target = 0; target < graph.num_verts(); target++)
+            {
+                std::vector<int> path;
+                CHECK(graph_algorithms::bidirectional_dijkstra(graph, source, target, path) == expected[target]);
+                CHECK(graph_algorithms::bidirectional_dijkstra(csr, source, target, context) == expected[target]);
+                if (expected[target] == UNREACHABLE)
+                {
+                    CHECK(path.empty() && context.path().empty());
+                    continue;
+                }
+                CHECK(path.front() == source && path.back() == target);
+                CHECK(path_length(graph, path) == expected[target]);
+                CHECK(path_length(csr, context.path()) == expected[target]);
+                CHECK(graph.shortest_distance(source, target) == expected[target]);
+            }
+        }
+    }
+    return result();
+}
@@ -0,0 +1,44 @@
+#include <vector>
+#include "parallelAlgorithms.h"
+#include "testSupport.h"
+#include "threadPool.h"
+
+using namespace test_support;
+
+// Borůvka returns exactly Kruskal's forest, which spans every component with the reference weight, with
+// any number of threads and with many tied weights.
+int main()
+{
+    for (int num_threads : {1, 2, 4})
+    {
+        ThreadPool pool(num_threads);
+        for (unsigned seed = 1; seed <= 8; seed++)
+        {
+            int max_weight = seed % 2 ? 2 : 1000;
+            Graph graph = random_graph(150, 80 + 50 * static_cast<int>(seed), max_weight, seed);
+            CsrGraph csr = graph.freeze();
+            long long expected = total_weight(graph_algorithms::kruskal(graph));
+            CHECK(expected == reference_forest_weight(graph));
+
+            std::vector<std::tuple<int, int, int> > forest = graph_algorithms::boruvka(csr, pool);
+            CHECK(is_spanning_forest(graph, forest));
+            CHECK(total_weight(forest) == expected);
+            CHECK(forest == graph_algorithms::kruskal(csr));
+            CHECK(total_weight(graph.boruvka_minimum_spanning_forest(pool)) == expected);
+        }
+
+        // A star: every forest edge leaves the hub, the case that used to rescan its whole list per edge.
+        Graph star;
+        star.add_vertices(20001);
+        for (int leaf = 1; leaf <= 20000; leaf++)
+        {
+            star.add_edge(0, leaf, leaf % 7 + 1);
+        }
+        CsrGraph star_csr = star.freeze();
+        CHECK(graph_algorithms::boruvka(star_csr, pool) == graph_algorithms::kruskal(star_csr));
+
+        Graph empty;
+        CHECK(graph_algorithms::boruvka(empty, pool).empty());
+    }
+    return result();
+}
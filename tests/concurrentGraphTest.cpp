@@ -0,0 +1,93 @@
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include "concurrentGraph.h"
+#include "testSupport.h"
+
+// Readers always see a whole published version, and removals reach readers at the next publish().
+int main()
+{
+    // A removed vertex no longer resolves in the version published after the removal.
+    {
+        ConcurrentGraph graph(1);
+        graph.add_vertex("A");
+        graph.add_vertex("B");
+        graph.add_vertex("C");
+        graph.add_edge("A", "B", 2);
+        graph.add_edge("B", "C", 3);
+        CHECK(graph.publish() == 1);
+        {
+            ConcurrentGraph::Snapshot snapshot = graph.pin(0);
+            CHECK(snapshot->id_of("B") == 1);
+            CHECK(snapshot->shortest_distance("A", "C") == 5);
+        }
+
+        CHECK(graph.remove_vertex("B"));
+        {
+            ConcurrentGraph::Snapshot snapshot = graph.pin(0);
+            CHECK(snapshot.version_number() == 1);
+            CHECK(snapshot->id_of("B") == 1);
+        }
+        CHECK(graph.publish() == 2);
+        {
+            ConcurrentGraph::Snapshot snapshot = graph.pin(0);
+            CHECK(snapshot.version_number() == 2);
+            CHECK(snapshot->id_of("B") == -1);
+            CHECK(!snapshot->has_edge("A", "B"));
+            CHECK(snapshot->shortest_distance("A", "C") == test_support::UNREACHABLE);
+        }
+    }
+
+    // Version v is a path 0 - 1 - ... - v with unit weights; readers check the version they pinned is whole.
+    {
+        const int num_readers = 3;
+        const int num_versions = 200;
+        ConcurrentGraph graph(num_readers);
+        graph.add_vertex("0");
+        std::atomic<bool> done(false);
+        std::atomic<int> torn(0);
+
+        std::vector<std::thread> readers;
+        for (int reader = 0; reader < num_readers; reader++)
+        {
+            readers.emplace_back([&, reader]()
+            {
+                while (!done.load())
+                {
+                    ConcurrentGraph::Snapshot snapshot = graph.pin(reader);
+                    int v = static_cast<int>(snapshot.version_number());
+                    if (v == 0)
+                    {
+                        continue;
+                    }
+                    if (snapshot->num_verts() != v + 1 || snapshot->shortest_distance(0, v) != v)
+                    {
+                        torn++;
+                    }
+                }
+            });
+        }
+
+        for (int v = 1; v <= num_versions; v++)
+        {
+            graph.update([&](Graph &working)
+            {
+                working.add_vertex(std::to_string(v));
+                return working.add_edge(v - 1, v, 1);
+            });
+            graph.publish();
+        }
+        done.store(true);
+        for (auto &reader : readers)
+        {
+            reader.join();
+        }
+        CHECK(torn.load() == 0);
+
+        ConcurrentGraph::Snapshot last = graph.pin(0);
+        CHECK(last.version_number() == static_cast<uint64_t>(num_versions));
+        CHECK(last->shortest_distance("0", std::to_string(num_versions)) == num_versions);
+    }
+    return test_support::result();
+}
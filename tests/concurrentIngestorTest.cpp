@@ -0,0 +1,110 @@
+#include <algorithm>
+#include <random>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include "concurrentIngestor.h"
+#include "testSupport.h"
+#include "threadPool.h"
+
+using namespace test_support;
+
+// Edges of a vertex as sorted (neighbor label, weight) pairs, which do not depend on vertex numbering.
+template <typename G>
+std::vector<std::pair<std::string, int> > labelled_edges(const G &graph, int u)
+{
+    std::vector<std::pair<std::string, int> > edges;
+    graph.for_each_neighbor(u, [&](int v, int weight)
+    {
+        edges.emplace_back(std::string(graph.label_of(v)), weight);
+    });
+    std::sort(edges.begin(), edges.end());
+    return edges;
+}
+
+// Edges ingested by several producers at once give the same graph as a sequential load, up to vertex
+// numbering and neighbor order.
+int main()
+{
+    const int num_producers = 4;
+    const int edges_per_producer = 500;
+    ThreadPool pool(num_producers);
+
+    for (unsigned seed = 1; seed <= 3; seed++)
+    {
+        // Every producer gets its own edges; labels are shared between producers.
+        std::vector<std::vector<std::tuple<std::string, std::string, int> > > batches(num_producers);
+        std::mt19937 random(seed);
+        std::uniform_int_distribution<int> vertex(0, 299);
+        std::uniform_int_distribution<int> weight(1, 20);
+        Graph sequential;
+        for (auto &batch : batches)
+        {
+            for (int e = 0; e < edges_per_producer; e++)
+            {
+                std::string from = "v" + std::to_string(vertex(random));
+                std::string to = "v" + std::to_string(vertex(random));
+                int w = weight(random);
+                batch.emplace_back(from, to, w);
+                sequential.add_vertex(from);
+                sequential.add_vertex(to);
+                sequential.add_edge(from, to, w);
+            }
+        }
+        sequential.add_vertex("isolated");
+
+        ConcurrentIngestor ingestor(num_producers);
+        ingestor.add_vertex("isolated");
+        pool.run_on_all([&](int producer)
+        {
+            const auto &batch = batches[producer];
+            for (size_t e = 0; e < batch.size(); e++)
+            {
+                if (e % 2 == 0)
+                {
+                    ingestor.add_edge(producer, std::get<0>(batch[e]), std::get<1>(batch[e]), std::get<2>(batch[e]));
+                }
+                else
+                {
+                    ingestor.add_edges(producer, {std::make_tuple(std::string_view(std::get<0>(batch[e])), std::string_view(std::get<1>(batch[e])), std::get<2>(batch[e]))});
+                }
+            }
+        });
+
+        CHECK(ingestor.num_verts() == sequential.num_verts());
+        CHECK(ingestor.num_edges() == static_cast<size_t>(num_producers * edges_per_producer));
+
+        CsrGraph csr = ingestor.build_csr(pool);
+        Graph graph = ingestor.build(pool);
+        CHECK(csr.num_verts() == sequential.num_verts());
+        CHECK(graph.num_verts() == sequential.num_verts());
+        CHECK(csr.num_edges() == sequential.num_edges());
+
+        for (int u = 0; u < sequential.num_verts(); u++)
+        {
+            std::string label(sequential.label_of(u));
+            int csr_id = csr.id_of(label);
+            int graph_id = graph.id_of(label);
+            CHECK(csr_id != -1 && graph_id != -1);
+            if (csr_id == -1 || graph_id == -1)
+            {
+                continue;
+            }
+            CHECK(csr.label_of(csr_id) == label);
+            CHECK(labelled_edges(csr, csr_id) == labelled_edges(sequential, u));
+            CHECK(labelled_edges(graph, graph_id) == labelled_edges(sequential, u));
+        }
+
+        for (int u = 0; u < sequential.num_verts(); u += 37)
+        {
+            std::string source(sequential.label_of(u));
+            std::vector<int> expected = reference_distances(sequential, u);
+            for (int v = 0; v < sequential.num_verts(); v += 7)
+            {
+                CHECK(csr.shortest_distance(source, std::string(sequential.label_of(v))) == expected[v]);
+            }
+        }
+    }
+    return result();
+}
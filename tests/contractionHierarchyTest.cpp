@@ -0,0 +1,81 @@
+#include <stdexcept>
+#include <vector>
+#include "contractionHierarchy.h"
+#include "testSupport.h"
+#include "threadPool.h"
+
+using namespace test_support;
+
+// Contraction hierarchy queries give Dijkstra's distances, unpack to real shortest paths, fill the
+// many-to-many matrix with the same values, and reject out-of-range indices.
+int main()
+{
+    ThreadPool pool(2);
+    for (unsigned seed = 1; seed <= 10; seed++)
+    {
+        Graph graph = random_graph(60, 40 + 10 * static_cast<int>(seed), seed % 2 ? 9 : 100, seed);
+        CsrGraph csr = graph.freeze();
+        ContractionHierarchy hierarchy(csr);
+        const int n = csr.num_verts();
+
+        std::vector<int> sources;
+        std::vector<int> targets;
+        for (int v = 0; v < n; v += 3)
+        {
+            sources.push_back(v);
+        }
+        for (int v = 1; v < n; v += 4)
+        {
+            targets.push_back(v);
+        }
+        DistanceMatrix matrix = hierarchy.distance_matrix(sources, targets, pool);
+
+        for (int source = 0; source < n; source++)
+        {
+            std::vector<int> expected = reference_distances(csr, source);
+            for (int target = 0; target < n; target++)
+            {
+                CHECK(hierarchy.distance(source, target) == expected[target]);
+                std::vector<int> path = hierarchy.path(source, target);
+                if (expected[target] == UNREACHABLE)
+                {
+                    CHECK(path.empty());
+                    continue;
+                }
+                CHECK(!path.empty() && path.front() == source && path.back() == target);
+                CHECK(path_length(csr, path) == expected[target]);
+            }
+        }
+        for (size_t row = 0; row < sources.size(); row++)
+        {
+            std::vector<int> expected = reference_distances(csr, sources[row]);
+            for (size_t col = 0; col < targets.size(); col++)
+            {
+                CHECK(matrix.at(static_cast<int>(row), static_cast<int>(col)) == expected[targets[col]]);
+            }
+        }
+
+        CHECK(hierarchy.distance(-1, 0) == -1);
+        CHECK(hierarchy.distance(0, n) == -1);
+        CHECK(hierarchy.path(n, 0).empty());
+        CHECK(hierarchy.path(0, -1).empty());
+
+        for (const auto &bad : {std::vector<int>{0, n}, std::vector<int>{-1}})
+        {
+            for (int side = 0; side < 2; side++)
+            {
+                bool threw = false;
+                try
+                {
+                    hierarchy.distance_matrix(side ? sources : bad, side ? bad : targets, pool);
+                }
+                catch (const std::out_of_range &)
+                {
+                    threw = true;
+                }
+                CHECK(threw);
+            }
+        }
+    }
+    return result();
+}
@@ -0,0 +1,63 @@
+#include <string>
+#include "csrGraph.h"
+#include "graph.h"
+#include "testSupport.h"
+
+using namespace test_support;
+
+// A frozen snapshot answers every query exactly like the graph it was frozen from.
+int main()
+{
+    for (unsigned seed = 1; seed <= 20; seed++)
+    {
+        Graph graph = random_graph(40, 25 + 5 * static_cast<int>(seed), 9, seed);
+        CsrGraph csr = graph.freeze();
+
+        CHECK(csr.num_verts() == graph.num_verts());
+        CHECK(csr.num_edges() == graph.num_edges());
+
+        for (int u = 0; u < graph.num_verts(); u++)
+        {
+            CHECK(csr.label_of(u) == graph.label_of(u));
+            CHECK(csr.id_of(graph.label_of(u)) == u);
+            for (int v = 0; v < graph.num_verts(); v++)
+            {
+                CHECK(csr.edge_weight(u, v) == graph.edge_weight(u, v));
+            }
+        }
+        CHECK(csr.id_of("missing") == -1);
+        CHECK(csr.edge_weight(-1, 0) == -1);
+
+        // Indices that name no vertex are rejected instead of indexing past the arrays.
+        std::vector<int> unused(graph.num_verts(), -1);
+        QueryContext unused_context;
+        CHECK(graph.dijkstra_shortest_distances(graph.num_verts(), unused).empty());
+        CHECK(!csr.dijkstra_shortest_distances(-1, unused_context));
+        CHECK(csr.shortest_distance(0, csr.num_verts()) == -1);
+        CHECK(graph.shortest_distance(-1, 0, unused_context) == -1 && unused_context.path().empty());
+        CHECK(csr.minimum_spanning_tree(csr.num_verts()).empty());
+
+        QueryContext context;
+        for (int source = 0; source < graph.num_verts(); source += 7)
+        {
+            std::vector<int> expected = reference_distances(graph, source);
+            std::vector<int> previous(graph.num_verts(), -1);
+            CHECK(graph.dijkstra_shortest_distances(source, previous) == expected);
+            CHECK(csr.dijkstra_shortest_distances(source, previous) == expected);
+
+            for (int target = 0; target < graph.num_verts(); target++)
+            {
+                CHECK(csr.shortest_distance(source, target, context) == expected[target]);
+                if (expected[target] != UNREACHABLE)
+                {
+                    CHECK(path_length(csr, context.path()) == expected[target]);
+                }
+                CHECK(graph.shortest_distance(std::to_string(source), std::to_string(target)) == expected[target]);
+            }
+        }
+
+        CHECK(total_weight(csr.minimum_spanning_tree(0)) == total_weight(graph.minimum_spanning_tree(0)));
+        CHECK(csr.minimum_spanning_tree("0") == graph.minimum_spanning_tree("0"));
+    }
+    return result();
+}
@@ -0,0 +1,56 @@
+#include <string>
+#include <vector>
+#include "parallelAlgorithms.h"
+#include "testSupport.h"
+#include "threadPool.h"
+
+using namespace test_support;
+
+// Delta-stepping gives Dijkstra's distances for every bucket width and thread count, and its previous
+// nodes lead back to the source along shortest paths.
+int main()
+{
+    for (int num_threads : {1, 4})
+    {
+        ThreadPool pool(num_threads);
+        for (unsigned seed = 1; seed <= 6; seed++)
+        {
+            // Weights up to a million with small deltas overflow the bucket window.
+            int max_weight = seed % 3 == 0 ? 9 : (seed % 3 == 1 ? 1000 : 1000000);
+            Graph graph = random_graph(200, 150 + 100 * static_cast<int>(seed), max_weight, seed);
+            CsrGraph csr = graph.freeze();
+            for (int delta : {0, 1, 7, 5000})
+            {
+                for (int source = 0; source < csr.num_verts(); source += 41)
+                {
+                    std::vector<int> expected = reference_distances(csr, source);
+                    std::vector<int> previous(csr.num_verts(), -1);
+                    std::vector<int> distances = graph_algorithms::delta_stepping(csr, source, previous, pool, delta);
+                    CHECK(distances == expected);
+                    for (int v = 0; v < csr.num_verts(); v++)
+                    {
+                        if (v == source || expected[v] == UNREACHABLE)
+                        {
+                            CHECK(previous[v] == -1);
+                            continue;
+                        }
+                        CHECK(previous[v] != -1 && path_length(csr, {previous[v], v}) == expected[v] - expected[previous[v]]);
+                    }
+                }
+            }
+            std::vector<int> previous(graph.num_verts(), -1);
+            CHECK(graph.delta_stepping_shortest_distances("0", previous, pool) == reference_distances(graph, 0));
+        }
+
+        // One edge far heavier than delta: the window stays small and the search jumps over the gap.
+        Graph path;
+        path.add_vertices(4);
+        path.add_edge(0, 1, 1);
+        path.add_edge(1, 2, 100000000);
+        path.add_edge(2, 3, 2);
+        std::vector<int> previous(4, -1);
+        CHECK(graph_algorithms::delta_stepping(path, 0, previous, pool, 1) == reference_distances(path, 0));
+        CHECK(previous[3] == 2 && previous[2] == 1);
+    }
+    return result();
+}
@@ -0,0 +1,50 @@
+#include <string>
+#include <vector>
+#include "parallelAlgorithms.h"
+#include "testSupport.h"
+#include "threadPool.h"
+
+using namespace test_support;
+
+// Every cell of a distance matrix holds the reference distance, with repeated sources and targets and
+// with any number of threads.
+int main()
+{
+    for (int num_threads : {1, 3})
+    {
+        ThreadPool pool(num_threads);
+        for (unsigned seed = 1; seed <= 6; seed++)
+        {
+            Graph graph = random_graph(70, 50 + 15 * static_cast<int>(seed), 20, seed);
+            CsrGraph csr = graph.freeze();
+
+            std::vector<int> sources = {0, 5, 5, 69};
+            std::vector<int> targets = {3, 0, 3, 12, 40, 69};
+            std::vector<std::string> source_labels;
+            std::vector<std::string> target_labels;
+            for (int v : sources)
+            {
+                source_labels.push_back(std::to_string(v));
+            }
+            for (int v : targets)
+            {
+                target_labels.push_back(std::to_string(v));
+            }
+
+            DistanceMatrix by_index = graph_algorithms::distance_matrix(csr, sources, targets, pool);
+            DistanceMatrix by_label = graph.distance_matrix(source_labels, target_labels, pool);
+            CHECK(by_index.rows == 4 && by_index.cols == 6);
+            CHECK(by_label.rows == 4 && by_label.cols == 6);
+            for (int row = 0; row < by_index.rows; row++)
+            {
+                std::vector<int> expected = reference_distances(csr, sources[row]);
+                for (int col = 0; col < by_index.cols; col++)
+                {
+                    CHECK(by_index.at(row, col) == expected[targets[col]]);
+                    CHECK(by_label.at(row, col) == expected[targets[col]]);
+                }
+            }
+        }
+    }
+    return result();
+}
@@ -0,0 +1,72 @@
+#include <random>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+#include "graphBuilder.h"
+#include "testSupport.h"
+#include "threadPool.h"
+
+using namespace test_support;
+
+// Edges of a vertex as (neighbor, weight) pairs in the order the graph visits them.
+template <typename G>
+std::vector<std::pair<int, int> > edges_of(const G &graph, int u)
+{
+    std::vector<std::pair<int, int> > edges;
+    graph.for_each_neighbor(u, [&](int v, int weight)
+    {
+        edges.emplace_back(v, weight);
+    });
+    return edges;
+}
+
+// Batches of label edges interned on several threads number the vertices and order the neighbors
+// exactly as a Graph filled edge by edge.
+int main()
+{
+    for (int num_threads : {1, 3, 4})
+    {
+        ThreadPool pool(num_threads);
+        for (unsigned seed = 1; seed <= 3; seed++)
+        {
+            std::mt19937 random(seed);
+            std::uniform_int_distribution<int> vertex(0, 399);
+            std::uniform_int_distribution<int> weight(1, 20);
+
+            Graph sequential;
+            GraphBuilder builder;
+            builder.add_vertex("first");
+            sequential.add_vertex("first");
+            for (int batch = 0; batch < 4; batch++)
+            {
+                std::vector<std::tuple<std::string, std::string, int> > edges;
+                for (int e = 0; e < 700; e++)
+                {
+                    std::string from = "v" + std::to_string(vertex(random));
+                    std::string to = "v" + std::to_string(vertex(random));
+                    int w = weight(random);
+                    edges.emplace_back(from, to, w);
+                    sequential.add_vertex(from);
+                    sequential.add_vertex(to);
+                    sequential.add_edge(from, to, w);
+                }
+                builder.add_edges(edges, pool);
+            }
+
+            CHECK(builder.num_verts() == sequential.num_verts());
+            CsrGraph csr = builder.build_csr(pool);
+            Graph graph = builder.build(pool);
+            CHECK(csr.num_edges() == sequential.num_edges());
+            for (int u = 0; u < sequential.num_verts(); u++)
+            {
+                std::string label(sequential.label_of(u));
+                CHECK(builder.id_of(label) == u);
+                CHECK(csr.id_of(label) == u);
+                CHECK(edges_of(csr, u) == edges_of(sequential, u));
+                CHECK(edges_of(graph, u) == edges_of(sequential, u));
+            }
+        }
+    }
+    return result();
+}
@@ -0,0 +1,146 @@
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+#include "graphBuilder.h"
+#include "graphImport.h"
+#include "testSupport.h"
+#include "threadPool.h"
+
+using namespace test_support;
+
+// Edges of a vertex as (neighbor, weight) pairs in the order the graph visits them.
+template <typename G>
+std::vector<std::pair<int, int> > edges_of(const G &graph, int u)
+{
+    std::vector<std::pair<int, int> > edges;
+    graph.for_each_neighbor(u, [&](int v, int weight)
+    {
+        edges.emplace_back(v, weight);
+    });
+    return edges;
+}
+
+// Replace a file's contents.
+void write_file(const std::string &path, const std::string &text)
+{
+    std::ofstream out(path, std::ios::binary);
+    out << text;
+}
+
+// Check that a built graph has the expected labels and neighbor lists, vertex for vertex.
+void check_same(const CsrGraph &graph, const Graph &expected)
+{
+    CHECK(graph.num_verts() == expected.num_verts());
+    if (graph.num_verts() != expected.num_verts())
+    {
+        return;
+    }
+    for (int u = 0; u < expected.num_verts(); u++)
+    {
+        CHECK(graph.label_of(u) == expected.label_of(u));
+        CHECK(edges_of(graph, u) == edges_of(expected, u));
+    }
+}
+
+// Each importer gives the same graph as adding its lines one by one, whatever the number of threads,
+// and rejects malformed files.
+int main()
+{
+    const std::string path = "graphImportTest.txt";
+
+    for (int num_threads : {1, 4})
+    {
+        ThreadPool pool(num_threads);
+
+        // Edge list with comments, blank lines, default weights and labels that are not numbers.
+        {
+            std::mt19937 random(7);
+            std::uniform_int_distribution<int> vertex(0, 499);
+            std::uniform_int_distribution<int> weight(1, 30);
+            std::string text = "# comment\n% another comment\n\n";
+            Graph expected;
+            for (int e = 0; e < 5000; e++)
+            {
+                std::string from = "n" + std::to_string(vertex(random));
+                std::string to = "n" + std::to_string(vertex(random));
+                int w = e % 5 == 0 ? 1 : weight(random);
+                text += from + " \t" + to + (e % 5 == 0 ? std::string() : " " + std::to_string(w)) + "\n";
+                expected.add_vertex(from);
+                expected.add_vertex(to);
+                expected.add_edge(from, to, w);
+            }
+            write_file(path, text);
+            GraphBuilder builder;
+            CHECK(graph_import::read_edge_list(path, builder, pool));
+            check_same(builder.build_csr(pool), expected);
+        }
+
+        // DIMACS with every road listed in both directions, read symmetric and as plain arcs.
+        {
+            std::string text = "c roads\np sp 4 6\na 1 2 3\na 2 1 3\na 2 3 4\na 3 2 4\na 1 4 10\na 4 1 10\n";
+            write_file(path, text);
+            Graph symmetric;
+            for (int v = 1; v <= 4; v++)
+            {
+                symmetric.add_vertex(std::to_string(v));
+            }
+            symmetric.add_edge("1", "2", 3);
+            symmetric.add_edge("2", "3", 4);
+            symmetric.add_edge("1", "4", 10);
+            GraphBuilder builder;
+            CHECK(graph_import::read_dimacs(path, builder, pool));
+            check_same(builder.build_csr(pool), symmetric);
+
+            Graph arcs;
+            for (int v = 1; v <= 4; v++)
+            {
+                arcs.add_vertex(std::to_string(v));
+            }
+            arcs.add_edge("1", "2", 3);
+            arcs.add_edge("2", "1", 3);
+            arcs.add_edge("2", "3", 4);
+            arcs.add_edge("3", "2", 4);
+            arcs.add_edge("1", "4", 10);
+            arcs.add_edge("4", "1", 10);
+            GraphBuilder arc_builder;
+            CHECK(graph_import::read_dimacs(path, arc_builder, pool, false));
+            check_same(arc_builder.build_csr(pool), arcs);
+        }
+
+        // METIS with edge weights (fmt 1): every edge appears from both ends and is added once.
+        {
+            std::string text = "% triangle plus a pendant\n4 4 1\n2 5 3 7\n1 5 3 2\n1 7 2 2 4 1\n3 1\n";
+            write_file(path, text);
+            Graph expected;
+            for (int v = 1; v <= 4; v++)
+            {
+                expected.add_vertex(std::to_string(v));
+            }
+            expected.add_edge("1", "2", 5);
+            expected.add_edge("1", "3", 7);
+            expected.add_edge("2", "3", 2);
+            expected.add_edge("3", "4", 1);
+            GraphBuilder builder;
+            CHECK(graph_import::read_metis(path, builder, pool));
+            check_same(builder.build_csr(pool), expected);
+        }
+
+        // Malformed lines and missing files are reported.
+        {
+            write_file(path, "a b 3\nc d x\n");
+            GraphBuilder builder;
+            CHECK(!graph_import::read_edge_list(path, builder, pool));
+            write_file(path, "p sp 2 1\na 1 5 3\n");
+            CHECK(!graph_import::read_dimacs(path, builder, pool));
+            write_file(path, "2 1\n2\n");
+            CHECK(!graph_import::read_metis(path, builder, pool));
+            std::remove(path.c_str());
+            CHECK(!graph_import::read_edge_list(path, builder, pool));
+        }
+    }
+    std::remove(path.c_str());
+    return result();
+}
@@ -0,0 +1,91 @@
+#include <random>
+#include <vector>
+#include "graphAlgorithms.h"
+#include "testSupport.h"
+
+using namespace test_support;
+
+// Run random insert_or_decrease / extract_min operations and compare every extracted key with the
+// smallest key of a plain array. Monotone heaps only get keys no smaller than the last extracted one.
+template <typename Heap>
+void check_operations(unsigned seed, bool monotone)
+{
+    const int capacity = 300;
+    std::mt19937 random(seed);
+    std::uniform_int_distribution<int> id(0, capacity - 1);
+    std::uniform_int_distribution<int> key(0, 1000);
+
+    Heap heap(capacity);
+    std::vector<int> keys(capacity, -1);
+    int last = 0;
+    for (int step = 0; step < 5000; step++)
+    {
+        if (random() % 3 != 0)
+        {
+            int v = id(random);
+            int k = monotone ? last + key(random) : key(random);
+            heap.insert_or_decrease(v, k);
+            if (keys[v] == -1 || k < keys[v])
+            {
+                keys[v] = k;
+            }
+            continue;
+        }
+
+        int smallest = -1;
+        for (int v = 0; v < capacity; v++)
+        {
+            if (keys[v] != -1 && (smallest == -1 || keys[v] < keys[smallest]))
+            {
+                smallest = v;
+            }
+        }
+        CHECK(heap.is_empty() == (smallest == -1));
+        if (smallest == -1)
+        {
+            continue;
+        }
+        auto [k, v] = heap.extract_min();
+        CHECK(k == keys[smallest] && keys[v] == k);
+        keys[v] = -1;
+        last = k;
+    }
+}
+
+// Dijkstra with the heap gives the reference distances and, unless the heap is monotone, Prim with it
+// gives a tree of the same weight as with the default heap.
+template <typename Heap>
+void check_algorithms(const Graph &graph)
+{
+    for (int source = 0; source < graph.num_verts(); source += 9)
+    {
+        std::vector<int> previous(graph.num_verts(), -1);
+        CHECK(graph_algorithms::dijkstra<Heap>(graph, source, previous) == reference_distances(graph, source));
+    }
+    if constexpr (!is_monotone_heap<Heap>::value)
+    {
+        CHECK(total_weight(graph_algorithms::prim<Heap>(graph, 0)) == total_weight(graph_algorithms::prim(graph, 0)));
+    }
+}
+
+// Every heap policy extracts keys in order under random operations and drives Dijkstra and Prim to
+// the same results as the default heap.
+int main()
+{
+    for (unsigned seed = 1; seed <= 5; seed++)
+    {
+        check_operations<IndexedMinHeap>(seed, false);
+        check_operations<DaryHeap<2> >(seed, false);
+        check_operations<DaryHeap<4> >(seed, false);
+        check_operations<PairingHeap>(seed, false);
+        check_operations<RadixHeap>(seed, true);
+
+        Graph graph = random_graph(80, 120 + 40 * static_cast<int>(seed), seed % 2 ? 9 : 100000, seed);
+        check_algorithms<IndexedMinHeap>(graph);
+        check_algorithms<DaryHeap<2> >(graph);
+        check_algorithms<DaryHeap<4> >(graph);
+        check_algorithms<PairingHeap>(graph);
+        check_algorithms<RadixHeap>(graph);
+    }
+    return result();
+}
@@ -0,0 +1,147 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include "contractionHierarchy.h"
+#include "hubLabels.h"
+#include "testSupport.h"
+
+using namespace test_support;
+
+// Read a whole file into a string.
+std::string read_file(const std::string &path)
+{
+    std::ifstream in(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+// Replace a file's contents.
+void write_file(const std::string &path, const std::string &bytes)
+{
+    std::ofstream out(path, std::ios::binary);
+    out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+}
+
+// Overwrite the int at a byte position of a file image.
+void poke_int(std::string &bytes, size_t position, int32_t value)
+{
+    std::memcpy(&bytes[position], &value, sizeof(value));
+}
+
+// Hub labels answer every distance query exactly like Dijkstra, round-trip through save()/load(), and
+// load() rejects files whose counts or arrays are inconsistent.
+int main()
+{
+    const std::string path = "hubLabelsTest.labels";
+
+    for (unsigned seed = 1; seed <= 10; seed++)
+    {
+        Graph graph = random_graph(40, 35 + 5 * static_cast<int>(seed), 9, seed);
+        CsrGraph csr = graph.freeze();
+        ContractionHierarchy hierarchy(csr);
+        HubLabels by_degree(csr);
+        HubLabels by_rank(csr, hierarchy);
+
+        for (int source = 0; source < csr.num_verts(); source++)
+        {
+            std::vector<int> expected = reference_distances(csr, source);
+            for (int target = 0; target < csr.num_verts(); target++)
+            {
+                CHECK(by_degree.distance(source, target) == expected[target]);
+                CHECK(by_rank.distance(source, target) == expected[target]);
+            }
+        }
+        CHECK(by_rank.distance(-1, 0) == -1);
+        CHECK(by_rank.distance(0, csr.num_verts()) == -1);
+
+        CHECK(by_rank.save(path));
+        HubLabels loaded;
+        CHECK(loaded.load(path));
+        CHECK(loaded.num_verts() == by_rank.num_verts());
+        CHECK(loaded.num_entries() == by_rank.num_entries());
+        for (int source = 0; source < csr.num_verts(); source += 5)
+        {
+            for (int target = 0; target < csr.num_verts(); target++)
+            {
+                CHECK(loaded.shortest_distance(std::to_string(source), std::to_string(target)) == by_rank.distance(source, target));
+            }
+        }
+    }
+
+    // Corrupt files are rejected and leave the loaded index unchanged.
+    Graph graph = random_graph(20, 40, 9, 99);
+    HubLabels labels(graph.freeze());
+    CHECK(labels.save(path));
+    const std::string original = read_file(path);
+
+    const size_t counts_position = 8;
+    size_t offsets_position = 16;
+    for (int v = 0; v < 20; v++)
+    {
+        offsets_position += sizeof(uint32_t) + std::to_string(v).size();
+    }
+    const size_t hubs_position = offsets_position + 21 * sizeof(int32_t);
+
+    auto rejects = [&](const std::string &bytes)
+    {
+        write_file(path, bytes);
+        HubLabels target = labels;
+        bool loaded = target.load(path);
+        return !loaded && target.num_entries() == labels.num_entries();
+    };
+
+    CHECK(rejects(original.substr(0, original.size() - 1)));
+    CHECK(rejects(original.substr(0, 20)));
+
+    std::string bytes = original;
+    poke_int(bytes, counts_position, 0x7fffffff);
+    CHECK(rejects(bytes));
+
+    bytes = original;
+    poke_int(bytes, counts_position + 4, 0x7fffffff);
+    CHECK(rejects(bytes));
+
+    bytes = original;
+    poke_int(bytes, 16, 0x7ffffff0);
+    CHECK(rejects(bytes));
+
+    bytes = original;
+    poke_int(bytes, offsets_position, 1);
+    CHECK(rejects(bytes));
+
+    bytes = original;
+    poke_int(bytes, offsets_position + 4 * sizeof(int32_t), labels.num_entries() + 1);
+    CHECK(rejects(bytes));
+
+    bytes = original;
+    poke_int(bytes, hubs_position, 20);
+    CHECK(rejects(bytes));
+
+    bytes = original;
+    poke_int(bytes, hubs_position, -1);
+    CHECK(rejects(bytes));
+
+    // Swapping the first two hubs of the first label that has two breaks its sort order.
+    int32_t first_offsets[21];
+    std::memcpy(first_offsets, original.data() + offsets_position, sizeof(first_offsets));
+    for (int v = 0; v < 20; v++)
+    {
+        if (first_offsets[v + 1] - first_offsets[v] >= 2)
+        {
+            bytes = original;
+            size_t position = hubs_position + first_offsets[v] * sizeof(int32_t);
+            std::swap_ranges(&bytes[position], &bytes[position + 4], &bytes[position + 4]);
+            CHECK(rejects(bytes));
+            break;
+        }
+    }
+
+    write_file(path, original);
+    HubLabels reloaded;
+    CHECK(reloaded.load(path));
+    std::remove(path.c_str());
+    return result();
+}
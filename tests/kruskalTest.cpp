@@ -0,0 +1,39 @@
+#include <tuple>
+#include <vector>
+#include "graphAlgorithms.h"
+#include "testSupport.h"
+
+using namespace test_support;
+
+// Kruskal and Filter-Kruskal span every component with the weight of a reference Prim forest, list
+// their edges by increasing weight with from < to, and agree with each other on Graph and CsrGraph.
+int main()
+{
+    for (unsigned seed = 1; seed <= 12; seed++)
+    {
+        // Sparse graphs fall apart into components; small weight ranges give many ties, large ones
+        // need several radix passes.
+        int max_weight = seed % 3 == 0 ? 3 : (seed % 3 == 1 ? 100 : 1000000);
+        Graph graph = random_graph(120, 60 + 60 * static_cast<int>(seed), max_weight, seed);
+        CsrGraph csr = graph.freeze();
+        long long expected = reference_forest_weight(graph);
+
+        for (const auto &forest : {graph_algorithms::kruskal(graph), graph_algorithms::filter_kruskal(graph),
+                                   graph.kruskal_minimum_spanning_forest(), csr.filter_kruskal_minimum_spanning_forest()})
+        {
+            CHECK(is_spanning_forest(graph, forest));
+            CHECK(total_weight(forest) == expected);
+            for (size_t i = 0; i < forest.size(); i++)
+            {
+                CHECK(std::get<0>(forest[i]) < std::get<1>(forest[i]));
+                CHECK(i == 0 || std::get<2>(forest[i - 1]) <= std::get<2>(forest[i]));
+                CHECK(graph.has_edge(std::get<0>(forest[i]), std::get<1>(forest[i])));
+            }
+        }
+    }
+
+    Graph empty;
+    CHECK(graph_algorithms::kruskal(empty).empty());
+    CHECK(graph_algorithms::filter_kruskal(empty).empty());
+    return result();
+}
@@ -0,0 +1,83 @@
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "labelTable.h"
+#include "testSupport.h"
+
+// The label table hands out ids in order of first appearance and resolves labels both ways exactly
+// like a std::map, through growth, freezing, interning after a freeze, and bulk appends.
+int main()
+{
+    std::mt19937 random(3);
+    std::uniform_int_distribution<int> pick(0, 20000);
+
+    LabelTable table;
+    std::map<std::string, int> expected;
+    std::vector<std::string> labels;
+    auto add = [&](const std::string &label)
+    {
+        auto inserted = expected.emplace(label, static_cast<int>(labels.size()));
+        if (inserted.second)
+        {
+            labels.push_back(label);
+        }
+        CHECK(table.intern(label) == inserted.first->second);
+    };
+    auto check_all = [&]()
+    {
+        CHECK(table.size() == static_cast<int>(labels.size()));
+        for (size_t id = 0; id < labels.size(); id++)
+        {
+            CHECK(table.id_of(labels[id]) == static_cast<int>(id));
+            CHECK(table.at(labels[id]) == static_cast<int>(id));
+            CHECK(table.label_of(static_cast<int>(id)) == labels[id]);
+        }
+        CHECK(table.id_of("never added") == -1);
+        bool threw = false;
+        try
+        {
+            table.at("never added");
+        }
+        catch (const std::out_of_range &)
+        {
+            threw = true;
+        }
+        CHECK(threw);
+    };
+
+    // Labels that share prefixes, the empty label, and many repeats.
+    add("");
+    for (int i = 0; i < 5000; i++)
+    {
+        add("vertex-" + std::to_string(pick(random)));
+    }
+    check_all();
+
+    table.freeze();
+    CHECK(table.is_frozen());
+    check_all();
+    for (int i = 0; i < 2000; i++)
+    {
+        add("late-" + std::to_string(pick(random)));
+    }
+    check_all();
+
+    LabelTable other;
+    std::vector<std::string> appended;
+    for (int i = 0; i < 1000; i++)
+    {
+        std::string label = "appended-" + std::to_string(i);
+        other.intern(label);
+        appended.push_back(label);
+    }
+    table.append(other);
+    for (const auto &label : appended)
+    {
+        expected.emplace(label, static_cast<int>(labels.size()));
+        labels.push_back(label);
+    }
+    check_all();
+    return test_support::result();
+}
@@ -0,0 +1,65 @@
+#include <utility>
+#include <vector>
+#include "csrGraph.h"
+#include "graph.h"
+#include "testSupport.h"
+
+using namespace test_support;
+
+// Check that a view yields exactly the edges for_each_neighbor visits, through every accessor.
+template <typename G>
+void check_view(const G &graph, int u)
+{
+    std::vector<std::pair<int, int> > expected;
+    graph.for_each_neighbor(u, [&](int v, int weight)
+    {
+        expected.emplace_back(v, weight);
+    });
+
+    NeighborView view = graph.neighbors(u);
+    CHECK(view.size() == expected.size());
+    CHECK(view.empty() == expected.empty());
+
+    std::vector<std::pair<int, int> > iterated;
+    for (Neighbor edge : view)
+    {
+        iterated.emplace_back(edge.id, edge.weight);
+    }
+    CHECK(iterated == expected);
+
+    for (size_t i = 0; i < view.size() && i < expected.size(); i++)
+    {
+        CHECK(view[i].id == expected[i].first && view[i].weight == expected[i].second);
+        CHECK(view.id(i) == expected[i].first && view.weight(i) == expected[i].second);
+        if (view.is_contiguous())
+        {
+            CHECK(view.id_data()[i] == expected[i].first && view.weight_data()[i] == expected[i].second);
+        }
+    }
+    CHECK(graph.neighbors(graph.label_of(u)).size() == expected.size());
+}
+
+// Neighbor views of a Graph (pairs) and a CsrGraph (parallel arrays) match for_each_neighbor.
+int main()
+{
+    for (unsigned seed = 1; seed <= 10; seed++)
+    {
+        Graph graph = random_graph(30, 60, 9, seed);
+        if (seed % 2 == 0)
+        {
+            graph.sort_adjacency();
+        }
+        CsrGraph csr = graph.freeze();
+        for (int u = 0; u < graph.num_verts(); u++)
+        {
+            check_view(graph, u);
+            check_view(csr, u);
+            CHECK(!graph.neighbors(u).is_contiguous() || graph.neighbors(u).empty());
+            CHECK(csr.neighbors(u).is_contiguous());
+        }
+        CHECK(graph.neighbors(-1).empty() && graph.neighbors(graph.num_verts()).empty());
+        CHECK(csr.neighbors("missing").empty());
+        CHECK(graph.neighbors("missing").begin() == graph.neighbors("missing").end());
+    }
+    return result();
+}
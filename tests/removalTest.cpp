@@ -0,0 +1,257 @@
+#include <cstdio>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+#include "contractionHierarchy.h"
+#include "graph.h"
+#include "hubLabels.h"
+#include "labelTable.h"
+#include "testSupport.h"
+
+using namespace test_support;
+
+// Graph with the surviving edges only, added in the same order, for reference distances.
+Graph rebuild(int num_verts, const std::vector<std::tuple<int, int, int> > &edges)
+{
+    Graph graph;
+    graph.add_vertices(num_verts);
+    for (const auto &edge : edges)
+    {
+        graph.add_edge(std::get<0>(edge), std::get<1>(edge), std::get<2>(edge));
+    }
+    return graph;
+}
+
+// Removing edges and vertices gives the same distances as never adding them, and removed vertices stay
+// unresolvable through freeze(), save()/load(), contraction hierarchies and hub labels.
+int main()
+{
+    const std::string snapshot_path = "removalTest.snapshot";
+
+    for (unsigned seed = 1; seed <= 10; seed++)
+    {
+        const int n = 30;
+        std::mt19937 random(seed);
+        std::uniform_int_distribution<int> vertex(0, n - 1);
+        std::uniform_int_distribution<int> weight(1, 9);
+
+        Graph graph;
+        graph.add_vertices(n);
+        std::vector<std::tuple<int, int, int> > edges;
+        for (int e = 0; e < 80; e++)
+        {
+            int from = vertex(random);
+            int to = vertex(random);
+            int w = weight(random);
+            graph.add_edge(from, to, w);
+            edges.emplace_back(from, to, w);
+        }
+        if (seed % 2 == 0)
+        {
+            graph.sort_adjacency();
+        }
+
+        // Remove some edges, each the first one added between its endpoints.
+        for (int r = 0; r < 15; r++)
+        {
+            auto [from, to, w] = edges[random() % edges.size()];
+            CHECK(graph.remove_edge(from, to));
+            for (size_t e = 0; e < edges.size(); e++)
+            {
+                int a = std::get<0>(edges[e]);
+                int b = std::get<1>(edges[e]);
+                if ((a == from && b == to) || (a == to && b == from))
+                {
+                    edges.erase(edges.begin() + e);
+                    break;
+                }
+            }
+        }
+
+        // Remove some vertices with all their edges.
+        std::vector<bool> gone(n, false);
+        for (int r = 0; r < 5; r++)
+        {
+            int u = vertex(random);
+            CHECK(graph.remove_vertex(u) == !gone[u]);
+            gone[u] = true;
+            std::vector<std::tuple<int, int, int> > kept;
+            for (const auto &edge : edges)
+            {
+                if (std::get<0>(edge) != u && std::get<1>(edge) != u)
+                {
+                    kept.push_back(edge);
+                }
+            }
+            edges = kept;
+        }
+
+        Graph reference = rebuild(n, edges);
+        CHECK(graph.num_edges() == reference.num_edges());
+        for (int source = 0; source < n; source++)
+        {
+            if (gone[source])
+            {
+                CHECK(graph.id_of(std::to_string(source)) == -1);
+                CHECK(!graph.has_vertex(source));
+                CHECK(graph.neighbors(source).empty());
+                continue;
+            }
+            std::vector<int> expected = reference_distances(reference, source);
+            std::vector<int> previous(n, -1);
+            CHECK(graph.dijkstra_shortest_distances(source, previous) == expected);
+        }
+
+        // The snapshot keeps the indices but forgets the labels of removed vertices.
+        CsrGraph csr = graph.freeze();
+        ContractionHierarchy hierarchy(csr);
+        HubLabels labels(csr, hierarchy);
+        for (int u = 0; u < n; u++)
+        {
+            std::string label = std::to_string(u);
+            if (!gone[u])
+            {
+                CHECK(csr.id_of(label) == u);
+                continue;
+            }
+            CHECK(csr.id_of(label) == -1);
+            CHECK(!csr.has_edge(label, "0"));
+            bool threw = false;
+            try
+            {
+                csr.shortest_distance(label, "0");
+            }
+            catch (const std::out_of_range &)
+            {
+                threw = true;
+            }
+            CHECK(threw);
+
+            threw = false;
+            try
+            {
+                hierarchy.shortest_distance(label, "0");
+            }
+            catch (const std::out_of_range &)
+            {
+                threw = true;
+            }
+            CHECK(threw);
+
+            threw = false;
+            try
+            {
+                labels.shortest_distance(label, "0");
+            }
+            catch (const std::out_of_range &)
+            {
+                threw = true;
+            }
+            CHECK(threw);
+        }
+
+        // A saved graph loads with the same vertices removed.
+        CHECK(graph.save(snapshot_path));
+        Graph loaded;
+        CHECK(loaded.load(snapshot_path));
+        CHECK(loaded.num_removed_verts() == graph.num_removed_verts());
+        for (int u = 0; u < n; u++)
+        {
+            CHECK(loaded.has_vertex(u) == !gone[u]);
+            CHECK(loaded.id_of(std::to_string(u)) == (gone[u] ? -1 : u));
+        }
+
+        // Compaction renumbers the survivors in order and keeps their distances.
+        std::vector<int> new_index = graph.compact();
+        CHECK(graph.num_removed_verts() == 0);
+        for (int source = 0; source < n; source++)
+        {
+            CHECK((new_index[source] == -1) == gone[source]);
+            if (gone[source])
+            {
+                continue;
+            }
+            std::vector<int> expected = reference_distances(reference, source);
+            std::vector<int> previous(graph.num_verts(), -1);
+            std::vector<int> distances = graph.dijkstra_shortest_distances(new_index[source], previous);
+            for (int target = 0; target < n; target++)
+            {
+                if (!gone[target])
+                {
+                    CHECK(distances[new_index[target]] == expected[target]);
+                }
+            }
+        }
+    }
+    std::remove(snapshot_path.c_str());
+
+    // Forgetting labels in a probing table keeps every other label reachable, and in a frozen one too.
+    for (bool frozen : {false, true})
+    {
+        LabelTable table;
+        for (int id = 0; id < 500; id++)
+        {
+            table.intern(std::to_string(id));
+        }
+        if (frozen)
+        {
+            table.freeze();
+        }
+        for (int id = 0; id < 500; id += 3)
+        {
+            table.forget(id);
+        }
+        for (int id = 0; id < 500; id++)
+        {
+            CHECK(table.id_of(std::to_string(id)) == (id % 3 == 0 ? -1 : id));
+            CHECK(table.label_of(id) == std::to_string(id));
+        }
+
+        // Growing the table rehashes it, and freezing it builds a perfect hash; neither brings a
+        // forgotten label back. Restoring it does.
+        for (int id = 500; id < 2000; id++)
+        {
+            table.intern(std::to_string(id));
+        }
+        table.freeze();
+        table.intern("after freeze");
+        for (int id = 0; id < 2000; id++)
+        {
+            CHECK(table.is_forgotten(id) == (id < 500 && id % 3 == 0));
+            CHECK(table.id_of(std::to_string(id)) == (id < 500 && id % 3 == 0 ? -1 : id));
+        }
+        table.restore(3);
+        CHECK(table.id_of("3") == 3 && !table.is_forgotten(3));
+        CHECK(table.intern("6") == table.size() - 1);
+        table.restore(6);
+        CHECK(table.is_forgotten(6) && table.id_of("6") == table.size() - 1);
+    }
+
+    // A vertex removed before saving comes back at its old index when it is added to the loaded graph.
+    {
+        Graph graph;
+        graph.add_vertex("A");
+        graph.add_vertex("B");
+        graph.add_vertex("C");
+        graph.add_edge("A", "B", 2);
+        graph.add_edge("B", "C", 3);
+        CHECK(graph.remove_vertex("B"));
+        CHECK(graph.save(snapshot_path));
+
+        Graph loaded;
+        CHECK(loaded.load(snapshot_path));
+        CHECK(loaded.id_of("B") == -1);
+        CHECK(!loaded.add_edge("A", "B", 5));
+        CHECK(loaded.add_vertex("B") == 1);
+        CHECK(loaded.num_verts() == 3 && loaded.num_removed_verts() == 0);
+        CHECK(loaded.id_of("B") == 1);
+        CHECK(loaded.add_edge("A", "B", 5));
+        CHECK(loaded.shortest_distance("A", "B") == 5);
+        CHECK(loaded.add_vertex("D") == 3);
+        CHECK(loaded.id_of("D") == 3 && loaded.id_of("C") == 2);
+        std::remove(snapshot_path.c_str());
+    }
+    return result();
+}
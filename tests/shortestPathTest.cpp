@@ -0,0 +1,54 @@
+#include <vector>
+#include "graphAlgorithms.h"
+#include "testSupport.h"
+
+using namespace test_support;
+
+// The bounded one-sided search finds Dijkstra's distances and paths, honours max_distance, and prunes
+// the shortest-distance tree at max_hops rather than searching for a hop-limited shortest path.
+int main()
+{
+    for (unsigned seed = 1; seed <= 10; seed++)
+    {
+        Graph graph = random_graph(50, 40 + 8 * static_cast<int>(seed), 9, seed);
+        QueryContext context;
+        for (int source = 0; source < graph.num_verts(); source += 7)
+        {
+            std::vector<int> expected = reference_distances(graph, source);
+            for (int target = 0; target < graph.num_verts(); target++)
+            {
+                int distance = graph_algorithms::dijkstra_to_target(graph, source, target, context);
+                CHECK(distance == expected[target]);
+                if (expected[target] != UNREACHABLE)
+                {
+                    CHECK(context.path().front() == source && context.path().back() == target);
+                    CHECK(path_length(graph, context.path()) == expected[target]);
+                }
+
+                ShortestPathOptions options;
+                options.max_distance = 12;
+                distance = graph_algorithms::dijkstra_to_target(graph, source, target, context, options);
+                CHECK(distance == (expected[target] <= 12 ? expected[target] : UNREACHABLE));
+            }
+        }
+    }
+
+    // A - B - C costs 2 over two edges, A - C costs 5 over one, and D hangs off C.
+    Graph graph;
+    graph.add_vertices(4);
+    graph.add_edge(0, 1, 1);
+    graph.add_edge(1, 2, 1);
+    graph.add_edge(0, 2, 5);
+    graph.add_edge(2, 3, 1);
+    QueryContext context;
+    ShortestPathOptions options;
+    options.max_hops = 2;
+    CHECK(graph_algorithms::dijkstra_to_target(graph, 0, 2, context, options) == 2);
+
+    // C is settled through B at its hop limit, so D is never reached, although A - C - D has two edges.
+    CHECK(graph_algorithms::dijkstra_to_target(graph, 0, 3, context, options) == UNREACHABLE);
+    CHECK(graph.shortest_path("0", "3", options) == "3");
+    options.max_hops = 3;
+    CHECK(graph_algorithms::dijkstra_to_target(graph, 0, 3, context, options) == 3);
+    return result();
+}
@@ -0,0 +1,205 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+#include "csrGraph.h"
+#include "testSupport.h"
+
+using namespace test_support;
+
+// Edges of a vertex as (neighbor, weight) pairs in the order the graph visits them.
+template <typename G>
+std::vector<std::pair<int, int> > edges_of(const G &graph, int u)
+{
+    std::vector<std::pair<int, int> > edges;
+    graph.for_each_neighbor(u, [&](int v, int weight)
+    {
+        edges.emplace_back(v, weight);
+    });
+    return edges;
+}
+
+// Read a whole file into a string.
+std::string read_file(const std::string &path)
+{
+    std::ifstream in(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+// Replace a file's contents.
+void write_file(const std::string &path, const std::string &bytes)
+{
+    std::ofstream out(path, std::ios::binary);
+    out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+}
+
+// Layout of the snapshot header and the checksum of csrGraph.cpp, so the test can write files whose
+// checksums match but whose arrays do not.
+struct SectionEntry {
+    uint64_t offset;
+    uint64_t bytes;
+    uint64_t checksum;
+};
+
+struct Header {
+    char magic[8];
+    uint32_t version;
+    uint32_t byte_order;
+    uint32_t word_bytes;
+    int32_t num_verts;
+    uint64_t file_bytes;
+    SectionEntry sections[8];
+    uint64_t header_checksum;
+};
+
+enum Section { OFFSETS, TARGETS, WEIGHTS, LABEL_ARENA, LABEL_OFFSETS, LABEL_HASHES, LABEL_SLOTS, LABEL_SEEDS };
+
+uint64_t checksum(const char *data, size_t bytes)
+{
+    const uint64_t prime = 0x9e3779b97f4a7c15ULL;
+    uint64_t lanes[4] = {1, 2, 3, 4};
+    size_t i = 0;
+    for (; i + sizeof(lanes) <= bytes; i += sizeof(lanes))
+    {
+        for (int k = 0; k < 4; k++)
+        {
+            uint64_t word;
+            std::memcpy(&word, data + i + k * sizeof(word), sizeof(word));
+            lanes[k] = (lanes[k] ^ word) * prime;
+            lanes[k] ^= lanes[k] >> 29;
+        }
+    }
+    for (int k = 0; i < bytes; k++)
+    {
+        uint64_t word = 0;
+        size_t n = std::min(bytes - i, sizeof(word));
+        std::memcpy(&word, data + i, n);
+        lanes[k] = (lanes[k] ^ word) * prime;
+        lanes[k] ^= lanes[k] >> 29;
+        i += n;
+    }
+    uint64_t h = bytes;
+    for (uint64_t lane : lanes)
+    {
+        h = (h ^ lane) * prime;
+        h ^= h >> 32;
+    }
+    return h;
+}
+
+// Overwrite element index of a section with value, then recompute that section's and the header's checksums.
+template <typename T>
+std::string forge(const std::string &original, Section section, size_t index, T value)
+{
+    std::string bytes = original;
+    Header header;
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    SectionEntry &entry = header.sections[section];
+    std::memcpy(&bytes[entry.offset + index * sizeof(T)], &value, sizeof(T));
+    entry.checksum = checksum(bytes.data() + entry.offset, entry.bytes);
+    std::memcpy(&bytes[0], &header, sizeof(header));
+    header.header_checksum = checksum(bytes.data(), offsetof(Header, header_checksum));
+    std::memcpy(&bytes[0], &header, sizeof(header));
+    return bytes;
+}
+
+// A snapshot written by save() maps back, and loads into a Graph, with the same labels, neighbor
+// lists and distances; truncated or corrupted files are rejected.
+int main()
+{
+    const std::string path = "snapshotTest.snapshot";
+
+    for (unsigned seed = 1; seed <= 5; seed++)
+    {
+        Graph graph = random_graph(80, 100 + 30 * static_cast<int>(seed), 50, seed);
+        graph.add_vertex("isolated");
+        CsrGraph csr = graph.freeze();
+        CHECK(csr.save(path));
+
+        for (bool verify : {false, true})
+        {
+            CsrGraph mapped;
+            CHECK(mapped.open(path, verify));
+            CHECK(mapped.num_verts() == csr.num_verts());
+            CHECK(mapped.num_edges() == csr.num_edges());
+            for (int u = 0; u < csr.num_verts(); u++)
+            {
+                CHECK(mapped.label_of(u) == csr.label_of(u));
+                CHECK(mapped.id_of(csr.label_of(u)) == u);
+                CHECK(edges_of(mapped, u) == edges_of(csr, u));
+            }
+            for (int source = 0; source < csr.num_verts(); source += 17)
+            {
+                std::vector<int> expected = reference_distances(csr, source);
+                for (int target = 0; target < csr.num_verts(); target++)
+                {
+                    CHECK(mapped.shortest_distance(source, target) == expected[target]);
+                }
+            }
+        }
+
+        Graph loaded;
+        CHECK(loaded.load(path, true));
+        CHECK(loaded.num_verts() == graph.num_verts());
+        for (int u = 0; u < graph.num_verts(); u++)
+        {
+            CHECK(loaded.label_of(u) == graph.label_of(u));
+            CHECK(edges_of(loaded, u) == edges_of(graph, u));
+        }
+        CHECK(graph.save(path));
+        CHECK(read_file(path).size() > 0);
+    }
+
+    // Truncated files never open; a flipped byte is caught when checksums are verified.
+    Graph graph = random_graph(30, 60, 9, 42);
+    graph.add_vertex("corrupted label");
+    CHECK(graph.save(path));
+    const std::string original = read_file(path);
+
+    write_file(path, original.substr(0, original.size() / 2));
+    CsrGraph truncated;
+    CHECK(!truncated.open(path));
+    CHECK(truncated.num_verts() == 0);
+    Graph unchanged = random_graph(5, 5, 9, 1);
+    CHECK(!unchanged.load(path));
+    CHECK(unchanged.num_verts() == 5);
+
+    // Flip a byte of a label in the label arena; the padding after the last section is not checksummed.
+    std::string corrupted = original;
+    size_t label_position = corrupted.find("corrupted label");
+    CHECK(label_position != std::string::npos);
+    corrupted[label_position] ^= 0x5a;
+    write_file(path, corrupted);
+    CsrGraph checked;
+    CHECK(!checked.open(path, true));
+
+    // Files whose checksums match but whose indices are out of range are rejected when verifying.
+    write_file(path, forge<int>(original, TARGETS, 0, 0));
+    CsrGraph resealed;
+    CHECK(resealed.open(path, true));
+    auto rejects = [&](const std::string &bytes)
+    {
+        write_file(path, bytes);
+        CsrGraph forged;
+        return !forged.open(path, true) && forged.num_verts() == 0;
+    };
+    CHECK(rejects(forge<int>(original, TARGETS, 3, 31)));
+    CHECK(rejects(forge<int>(original, TARGETS, 0, -1)));
+    CHECK(rejects(forge<int>(original, OFFSETS, 5, 1000)));
+    CHECK(rejects(forge<int>(original, OFFSETS, 1, -4)));
+    CHECK(rejects(forge<int>(original, LABEL_SLOTS, 0, 31)));
+    CHECK(rejects(forge<int>(original, LABEL_SLOTS, 1, -2)));
+    CHECK(rejects(forge<size_t>(original, LABEL_OFFSETS, 3, 0)));
+    CHECK(rejects(forge<size_t>(original, LABEL_OFFSETS, 2, 100000)));
+
+    std::remove(path.c_str());
+    CsrGraph missing;
+    CHECK(!missing.open(path));
+    return result();
+}
@@ -0,0 +1,100 @@
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+#include "csrGraph.h"
+#include "testSupport.h"
+
+using namespace test_support;
+
+// Check that two graphs agree on has_edge and edge_weight for every pair of vertices.
+template <typename A, typename B>
+void check_same_lookups(const A &graph, const B &expected)
+{
+    for (int u = 0; u < expected.num_verts(); u++)
+    {
+        for (int v = 0; v < expected.num_verts(); v++)
+        {
+            CHECK(graph.has_edge(u, v) == expected.has_edge(u, v));
+            CHECK(graph.edge_weight(u, v) == expected.edge_weight(u, v));
+        }
+    }
+}
+
+// Check that every neighbor list is in increasing neighbor order.
+template <typename G>
+void check_sorted(const G &graph)
+{
+    for (int u = 0; u < graph.num_verts(); u++)
+    {
+        int last = -1;
+        graph.for_each_neighbor(u, [&](int v, int)
+        {
+            CHECK(last <= v);
+            last = v;
+        });
+    }
+}
+
+// Sorted adjacency answers edge lookups exactly like the scanning mode, including on hub vertices
+// with a hash index, with parallel edges, after further edges are added, and on mapped snapshots.
+int main()
+{
+    const std::string path = "sortedAdjacencyTest.snapshot";
+
+    for (unsigned seed = 1; seed <= 4; seed++)
+    {
+        // Vertex 0 is a hub above the hash index threshold; random edges add parallel edges and loops.
+        const int n = 400;
+        Graph unsorted = random_graph(n, 600, 30, seed);
+        std::mt19937 random(seed);
+        std::uniform_int_distribution<int> vertex(0, n - 1);
+        std::uniform_int_distribution<int> weight(1, 30);
+        for (int v = 1; v < n; v += 2)
+        {
+            unsorted.add_edge(0, v, weight(random));
+        }
+
+        Graph sorted = unsorted;
+        sorted.sort_adjacency();
+        CHECK(sorted.has_sorted_adjacency() && !unsorted.has_sorted_adjacency());
+        check_sorted(sorted);
+        check_same_lookups(sorted, unsorted);
+
+        // Edges added afterwards keep the lists sorted and the hub index current.
+        for (int e = 0; e < 300; e++)
+        {
+            int from = e % 3 == 0 ? 0 : vertex(random);
+            int to = vertex(random);
+            int w = weight(random);
+            unsorted.add_edge(from, to, w);
+            sorted.add_edge(from, to, w);
+        }
+        check_sorted(sorted);
+        check_same_lookups(sorted, unsorted);
+        for (int source = 0; source < n; source += 97)
+        {
+            CHECK(reference_distances(sorted, source) == reference_distances(unsorted, source));
+        }
+
+        CsrGraph csr = unsorted.freeze();
+        CsrGraph sorted_csr = unsorted.freeze();
+        sorted_csr.sort_adjacency();
+        CHECK(sorted_csr.has_sorted_adjacency());
+        check_sorted(sorted_csr);
+        check_same_lookups(sorted_csr, csr);
+
+        // A snapshot of a sorted graph maps back already sorted; one of an unsorted graph gets sorted.
+        for (const CsrGraph *source : {&csr, &sorted_csr})
+        {
+            CHECK(source->save(path));
+            CsrGraph mapped;
+            CHECK(mapped.open(path));
+            mapped.sort_adjacency();
+            check_sorted(mapped);
+            check_same_lookups(mapped, csr);
+        }
+    }
+    std::remove(path.c_str());
+    return result();
+}
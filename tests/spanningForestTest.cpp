@@ -0,0 +1,73 @@
+#include <queue>
+#include <tuple>
+#include <vector>
+#include "graphAlgorithms.h"
+#include "testSupport.h"
+
+using namespace test_support;
+
+// The oriented forest numbers components by their lowest vertex, roots every tree there, lists
+// parents before children, and weighs as much per component as Prim's tree from that root.
+int main()
+{
+    for (unsigned seed = 1; seed <= 10; seed++)
+    {
+        Graph graph = random_graph(100, 30 + 15 * static_cast<int>(seed), 50, seed);
+        const int n = graph.num_verts();
+        SpanningForest forest = graph.minimum_spanning_forest();
+
+        // Components by breadth-first search, numbered in order of their lowest vertex.
+        std::vector<int> component(n, -1);
+        std::vector<int> roots;
+        for (int root = 0; root < n; root++)
+        {
+            if (component[root] != -1)
+            {
+                continue;
+            }
+            component[root] = static_cast<int>(roots.size());
+            roots.push_back(root);
+            std::queue<int> queue;
+            queue.push(root);
+            while (!queue.empty())
+            {
+                int u = queue.front();
+                queue.pop();
+                graph.for_each_neighbor(u, [&](int v, int)
+                {
+                    if (component[v] == -1)
+                    {
+                        component[v] = component[root];
+                        queue.push(v);
+                    }
+                });
+            }
+        }
+
+        CHECK(forest.num_components == static_cast<int>(roots.size()));
+        CHECK(forest.component == component);
+        CHECK(is_spanning_forest(graph, forest.edges));
+        CHECK(total_weight(forest.edges) == reference_forest_weight(graph));
+
+        std::vector<bool> placed(n, false);
+        std::vector<long long> component_weights(roots.size(), 0);
+        for (int root : roots)
+        {
+            CHECK(forest.parent[root] == -1);
+            placed[root] = true;
+        }
+        for (const auto &[parent, child, weight] : forest.edges)
+        {
+            CHECK(placed[parent] && !placed[child]);
+            CHECK(forest.parent[child] == parent);
+            CHECK(graph.has_edge(parent, child));
+            placed[child] = true;
+            component_weights[component[child]] += weight;
+        }
+        for (size_t c = 0; c < roots.size(); c++)
+        {
+            CHECK(component_weights[c] == total_weight(graph_algorithms::prim(graph, roots[c])));
+        }
+    }
+    return result();
+}
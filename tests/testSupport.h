@@ -0,0 +1,208 @@
+#ifndef GRAPHLIB_TESTSUPPORT_H
+#define GRAPHLIB_TESTSUPPORT_H
+
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <queue>
+#include <random>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include "graph.h"
+
+// Helpers shared by the test executables. CHECK reports a failed condition and carries on, so one run
+// lists every failure; main returns test_support::result(), which ctest reads as pass or fail.
+namespace test_support {
+
+// Distance of vertices the source cannot reach, as the library reports it.
+const int UNREACHABLE = std::numeric_limits<int>::max();
+
+// Number of failed checks so far.
+inline int &failures()
+{
+    static int count = 0;
+    return count;
+}
+
+// Record a check, printing where it failed.
+inline void check(bool ok, const char *expression, const char *file, int line)
+{
+    if (!ok)
+    {
+        std::cerr << file << ":" << line << ": check failed: " << expression << std::endl;
+        failures()++;
+    }
+}
+
+// Exit code of a test executable: 0 if every check passed.
+inline int result()
+{
+    if (failures() != 0)
+    {
+        std::cerr << failures() << " check(s) failed" << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+// Random undirected graph with vertices labelled "0" .. "num_verts - 1" and weights in [1, max_weight].
+// Few edges leave it disconnected; parallel edges and self-loops are allowed.
+inline Graph random_graph(int num_verts, int num_edges, int max_weight, unsigned seed)
+{
+    std::mt19937 random(seed);
+    std::uniform_int_distribution<int> vertex(0, num_verts - 1);
+    std::uniform_int_distribution<int> weight(1, max_weight);
+
+    Graph graph;
+    graph.add_vertices(num_verts);
+    for (int e = 0; e < num_edges; e++)
+    {
+        int from = vertex(random);
+        int to = vertex(random);
+        graph.add_edge(from, to, weight(random));
+    }
+    return graph;
+}
+
+// Textbook Dijkstra over for_each_neighbor with std::priority_queue, independent of the library's heaps.
+template <typename G>
+std::vector<int> reference_distances(const G &graph, int source)
+{
+    std::vector<int> distances(graph.num_verts(), UNREACHABLE);
+    std::priority_queue<std::pair<int, int>, std::vector<std::pair<int, int> >, std::greater<std::pair<int, int> > > queue;
+    distances[source] = 0;
+    queue.emplace(0, source);
+    while (!queue.empty())
+    {
+        auto [distance, u] = queue.top();
+        queue.pop();
+        if (distance != distances[u])
+        {
+            continue;
+        }
+        graph.for_each_neighbor(u, [&](int v, int weight)
+        {
+            if (distance + weight < distances[v])
+            {
+                distances[v] = distance + weight;
+                queue.emplace(distances[v], v);
+            }
+        });
+    }
+    return distances;
+}
+
+// Weight of a minimum spanning forest, by textbook Prim with std::priority_queue from every vertex not
+// yet spanned, independent of the library's heaps and union-find.
+template <typename G>
+long long reference_forest_weight(const G &graph)
+{
+    std::vector<bool> spanned(graph.num_verts(), false);
+    std::priority_queue<std::pair<int, int>, std::vector<std::pair<int, int> >, std::greater<std::pair<int, int> > > queue;
+    long long total = 0;
+    for (int root = 0; root < graph.num_verts(); root++)
+    {
+        if (spanned[root])
+        {
+            continue;
+        }
+        queue.emplace(0, root);
+        while (!queue.empty())
+        {
+            auto [weight, u] = queue.top();
+            queue.pop();
+            if (spanned[u])
+            {
+                continue;
+            }
+            spanned[u] = true;
+            total += weight;
+            graph.for_each_neighbor(u, [&](int v, int w)
+            {
+                if (!spanned[v])
+                {
+                    queue.emplace(w, v);
+                }
+            });
+        }
+    }
+    return total;
+}
+
+// Check that (from, to, weight) edges join distinct trees one by one and, together, span every
+// connected component of the graph, with a plain parent-array union-find.
+template <typename G>
+bool is_spanning_forest(const G &graph, const std::vector<std::tuple<int, int, int> > &edges)
+{
+    std::vector<int> parent(graph.num_verts());
+    for (int v = 0; v < graph.num_verts(); v++)
+    {
+        parent[v] = v;
+    }
+    std::function<int(int)> find = [&](int v) { return parent[v] == v ? v : parent[v] = find(parent[v]); };
+
+    for (const auto &[from, to, weight] : edges)
+    {
+        if (from < 0 || to < 0 || from >= graph.num_verts() || to >= graph.num_verts() || find(from) == find(to))
+        {
+            return false;
+        }
+        parent[find(from)] = find(to);
+    }
+    for (int u = 0; u < graph.num_verts(); u++)
+    {
+        bool joined = true;
+        graph.for_each_neighbor(u, [&](int v, int)
+        {
+            joined = joined && find(u) == find(v);
+        });
+        if (!joined)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Length of a path of vertex indices, or -1 if two consecutive vertices are not adjacent.
+template <typename G>
+int path_length(const G &graph, const std::vector<int> &path)
+{
+    int length = 0;
+    for (size_t i = 0; i + 1 < path.size(); i++)
+    {
+        int best = -1;
+        graph.for_each_neighbor(path[i], [&](int v, int weight)
+        {
+            if (v == path[i + 1] && (best == -1 || weight < best))
+            {
+                best = weight;
+            }
+        });
+        if (best == -1)
+        {
+            return -1;
+        }
+        length += best;
+    }
+    return length;
+}
+
+// Total weight of a list of (from, to, weight) edges.
+template <typename Vertex>
+long long total_weight(const std::vector<std::tuple<Vertex, Vertex, int> > &edges)
+{
+    long long total = 0;
+    for (const auto &edge : edges)
+    {
+        total += std::get<2>(edge);
+    }
+    return total;
+}
+
+} // namespace test_support
+
+#define CHECK(expression) test_support::check((expression), #expression, __FILE__, __LINE__)
+
+#endif //GRAPHLIB_TESTSUPPORT_H
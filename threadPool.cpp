@@ -0,0 +1,179 @@
+#include "threadPool.h"
+#include <atomic>
+
+/**
+ * Creates the pool and starts its worker threads.
+ *
+ * @param num_threads The total number of threads including the caller; <= 0 means one per hardware thread.
+ */
+ThreadPool::ThreadPool(int num_threads) : generation(0), pending(0), stopping(false)
+{
+    if (num_threads <= 0)
+    {
+        num_threads = static_cast<int>(std::thread::hardware_concurrency());
+        if (num_threads <= 0)
+        {
+            num_threads = 1;
+        }
+    }
+    for (int i = 1; i < num_threads; i++)
+    {
+        workers.emplace_back(&ThreadPool::_worker, this, i);
+    }
+}
+
+/**
+ * Stops and joins every worker thread.
+ */
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    job_ready.notify_all();
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+}
+
+/**
+ * Private main loop of a worker: wait for a new job generation, run it, report completion.
+ *
+ * @param index The thread index passed to every job.
+ */
+void ThreadPool::_worker(int index)
+{
+    unsigned long seen = 0;
+    while (true)
+    {
+        std::function<void(int)> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            job_ready.wait(lock, [&] { return stopping || generation != seen; });
+            if (stopping)
+            {
+                return;
+            }
+            seen = generation;
+            task = job;
+        }
+
+        try
+        {
+            task(index);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!failure)
+            {
+                failure = std::current_exception();
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (--pending == 0)
+        {
+            job_done.notify_one();
+        }
+    }
+}
+
+/**
+ * Returns the number of threads that run each job.
+ *
+ * @return The number of worker threads plus the calling thread.
+ */
+int ThreadPool::num_threads() const
+{
+    return static_cast<int>(workers.size()) + 1;
+}
+
+/**
+ * Runs a task once on every thread of the pool, with the caller acting as thread 0.
+ *
+ * @param task The task, called with the index of the thread running it.
+ * @throws Whatever the first failing thread threw, once every thread has finished.
+ */
+void ThreadPool::run_on_all(const std::function<void(int)> &task)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        job = task;
+        pending = static_cast<int>(workers.size());
+        failure = nullptr;
+        generation++;
+    }
+    job_ready.notify_all();
+
+    std::exception_ptr caller_failure;
+    try
+    {
+        task(0);
+    }
+    catch (...)
+    {
+        caller_failure = std::current_exception();
+    }
+
+    std::unique_lock<std::mutex> lock(mutex);
+    job_done.wait(lock, [&] { return pending == 0; });
+    job = nullptr;
+    if (caller_failure)
+    {
+        std::rethrow_exception(caller_failure);
+    }
+    if (failure)
+    {
+        std::rethrow_exception(failure);
+    }
+}
+
+/**
+ * Runs a loop body over a range of indices on every thread. Threads repeatedly claim the next
+ * chunk of grain indices from a shared counter until the range is exhausted.
+ *
+ * @param begin The first index.
+ * @param end   One past the last index.
+ * @param body  The loop body, called as body(thread_index, i).
+ * @param grain The number of consecutive indices a thread claims at once.
+ */
+void ThreadPool::parallel_for(int begin, int end, const std::function<void(int, int)> &body, int grain)
+{
+    if (begin >= end)
+    {
+        return;
+    }
+    if (grain < 1)
+    {
+        grain = 1;
+    }
+    if (workers.empty() || end - begin <= grain)
+    {
+        for (int i = begin; i < end; i++)
+        {
+            body(0, i);
+        }
+        return;
+    }
+
+    std::atomic<int> next(begin);
+    run_on_all([&](int thread_index)
+    {
+        while (true)
+        {
+            int chunk = next.fetch_add(grain);
+            if (chunk >= end)
+            {
+                break;
+            }
+            int chunk_end = chunk + grain < end ? chunk + grain : end;
+            for (int i = chunk; i < chunk_end; i++)
+            {
+                body(thread_index, i);
+            }
+        }
+    });
+}
@@ -0,0 +1,51 @@
+#ifndef GRAPHLIB_THREADPOOL_H
+#define GRAPHLIB_THREADPOOL_H
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fixed set of worker threads for the parallel algorithms. The calling thread takes part as thread 0,
+// so a pool of one thread runs everything inline. Work is handed out in chunks from a shared counter,
+// which keeps every thread busy even when iterations differ wildly in cost.
+class ThreadPool {
+
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable job_ready;
+    std::condition_variable job_done;
+    std::function<void(int)> job;       // The task every thread runs once per generation.
+    unsigned long generation;           // Incremented each time a new job is published.
+    int pending;                        // Worker threads still running the current job.
+    bool stopping;
+    std::exception_ptr failure;         // First exception thrown by a worker during the current job.
+
+    // Main loop of worker thread index.
+    void _worker(int index);
+
+public:
+
+    // Create a pool with num_threads threads in total, or one per hardware thread if num_threads <= 0.
+    explicit ThreadPool(int num_threads = 0);
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    // Stop and join every worker.
+    ~ThreadPool();
+
+    // Get the total number of threads, including the calling thread.
+    int num_threads() const;
+
+    // Run task(thread_index) once on every thread and wait for all of them.
+    // Rethrows the first exception any thread raised.
+    void run_on_all(const std::function<void(int)> &task);
+
+    // Run body(thread_index, i) for every i in [begin, end), handing out chunks of grain iterations.
+    void parallel_for(int begin, int end, const std::function<void(int, int)> &body, int grain = 64);
+};
+
+#endif //GRAPHLIB_THREADPOOL_H
@@ -0,0 +1,68 @@
+#ifndef GRAPHLIB_UNIONFIND_H
+#define GRAPHLIB_UNIONFIND_H
+
+#include <vector>
+
+// Disjoint sets over the elements [0, n) for Kruskal-style algorithms. Sets are joined by rank, so
+// trees stay logarithmically shallow, and find() points every element on the walked path straight at
+// the root, which makes a sequence of operations run in nearly constant amortized time per call.
+class UnionFind {
+
+    std::vector<int> parents;         // Parent of each element; a root is its own parent.
+    std::vector<unsigned char> ranks; // Upper bound on the height of each root's tree.
+
+public:
+
+    // Constructor to put each of n elements in a set of its own.
+    explicit UnionFind(int n) : parents(n), ranks(n, 0)
+    {
+        for (int v = 0; v < n; v++)
+        {
+            parents[v] = v;
+        }
+    }
+
+    // Get the representative of the set containing v.
+    int find(int v)
+    {
+        int root = v;
+        while (parents[root] != root)
+        {
+            root = parents[root];
+        }
+        while (parents[v] != root)
+        {
+            int next = parents[v];
+            parents[v] = root;
+            v = next;
+        }
+        return root;
+    }
+
+    // Join the sets containing a and b. Returns false if they were already the same set.
+    bool unite(int a, int b)
+    {
+        a = find(a);
+        b = find(b);
+        if (a == b)
+        {
+            return false;
+        }
+        if (ranks[a] < ranks[b])
+        {
+            parents[a] = b;
+        }
+        else
+        {
+            parents[b] = a;
+            if (ranks[a] == ranks[b])
+            {
+                ranks[a]++;
+            }
+        }
+        return true;
+    }
+
+};
+
+#endif //GRAPHLIB_UNIONFIND_H